@@ -0,0 +1,9 @@
+#include "AdminStatsRequest.h"
+
+void AdminStatsRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+}
+
+void AdminStatsRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Message.h"
+
+struct AdminStatsRequest : ClientAdminMessage
+{
+    static constexpr ClientAdminOpcode Opcode = kAdminStatsRequest;
+
+    AdminStatsRequest()
+        : ClientAdminMessage(Opcode)
+    {
+    }
+
+    virtual ~AdminStatsRequest() = default;
+
+    void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
+
+    bool operator==(const AdminStatsRequest& achRhs) const noexcept { return GetOpcode() == achRhs.GetOpcode(); }
+};
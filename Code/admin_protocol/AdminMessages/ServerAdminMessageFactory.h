@@ -6,6 +6,7 @@
 
 #include "ServerLogs.h"
 #include "AdminSessionOpen.h"
+#include "ServerTickStats.h"
 
 using TiltedPhoques::UniquePtr;
 
@@ -15,7 +16,7 @@ struct ServerAdminMessageFactory
 
     template <class T> static auto Visit(T&& func)
     {
-        auto s_visitor = CreateMessageVisitor<AdminSessionOpen, ServerLogs>;
+        auto s_visitor = CreateMessageVisitor<AdminSessionOpen, ServerLogs, ServerTickStats>;
 
         return s_visitor(std::forward<T>(func));
     }
@@ -0,0 +1,35 @@
+#include "ServerTickStats.h"
+
+void ServerTickStats::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    Serialization::WriteVarInt(aWriter, WindowMilliseconds);
+    Serialization::WriteVarInt(aWriter, Sections.size());
+
+    for (const auto& section : Sections)
+    {
+        Serialization::WriteString(aWriter, section.Name);
+        Serialization::WriteVarInt(aWriter, section.Count);
+        Serialization::WriteVarInt(aWriter, section.TotalMicroseconds);
+        Serialization::WriteVarInt(aWriter, section.MedianMicroseconds);
+        Serialization::WriteVarInt(aWriter, section.P99Microseconds);
+        Serialization::WriteVarInt(aWriter, section.MaxMicroseconds);
+    }
+}
+
+void ServerTickStats::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    WindowMilliseconds = Serialization::ReadVarInt(aReader);
+
+    const auto cCount = Serialization::ReadVarInt(aReader);
+    Sections.resize(cCount);
+
+    for (auto& section : Sections)
+    {
+        section.Name = Serialization::ReadString(aReader);
+        section.Count = Serialization::ReadVarInt(aReader);
+        section.TotalMicroseconds = Serialization::ReadVarInt(aReader);
+        section.MedianMicroseconds = Serialization::ReadVarInt(aReader);
+        section.P99Microseconds = Serialization::ReadVarInt(aReader);
+        section.MaxMicroseconds = Serialization::ReadVarInt(aReader);
+    }
+}
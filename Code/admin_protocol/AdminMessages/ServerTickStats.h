@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Message.h"
+
+using TiltedPhoques::Vector;
+
+struct ServerTickStats : ServerAdminMessage
+{
+    static constexpr ServerAdminOpcode Opcode = kServerTickStats;
+
+    struct Section
+    {
+        bool operator==(const Section& acRhs) const noexcept = default;
+
+        String Name;
+        uint64_t Count{0};
+        uint64_t TotalMicroseconds{0};
+        uint64_t MedianMicroseconds{0};
+        uint64_t P99Microseconds{0};
+        uint64_t MaxMicroseconds{0};
+    };
+
+    ServerTickStats()
+        : ServerAdminMessage(Opcode)
+    {
+    }
+
+    virtual ~ServerTickStats() = default;
+
+    void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
+
+    bool operator==(const ServerTickStats& achRhs) const noexcept { return GetOpcode() == achRhs.GetOpcode() && WindowMilliseconds == achRhs.WindowMilliseconds && Sections == achRhs.Sections; }
+
+    uint64_t WindowMilliseconds{0};
+    Vector<Section> Sections;
+};
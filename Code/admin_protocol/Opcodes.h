@@ -3,6 +3,7 @@
 enum ClientAdminOpcode : unsigned char
 {
     kAdminShutdown = 0,
+    kAdminStatsRequest,
 
     kClientAdminOpcodeMax
 };
@@ -11,6 +12,7 @@ enum ServerAdminOpcode : unsigned char
 {
     kAdminSessionOpen = 0,
     kServerLogs,
+    kServerTickStats,
 
     kServerAdminOpcodeMax
 };
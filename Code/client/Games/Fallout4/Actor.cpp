@@ -118,17 +118,17 @@ ActorValues Actor::GetEssentialActorValues() noexcept
     {
         ActorValueInfo* pActorValueInfo = GetActorValueInfo(i);
         float value = actorValueOwner.GetValue(pActorValueInfo);
-        actorValues.ActorValuesList.insert({i, value});
+        actorValues.ActorValuesList.Set(i, value);
         float maxValue = actorValueOwner.GetMaxValue(pActorValueInfo);
-        actorValues.ActorMaxValuesList.insert({i, maxValue});
+        actorValues.ActorMaxValuesList.Set(i, maxValue);
     }
 
     ActorValueInfo* pActorValueInfoRads = GetActorValueInfo(ActorValueInfo::kRads);
     float valueRads = actorValueOwner.GetValue(pActorValueInfoRads);
-    actorValues.ActorValuesList.insert({ActorValueInfo::kRads, valueRads});
+    actorValues.ActorValuesList.Set(ActorValueInfo::kRads, valueRads);
     ActorValueInfo* pActorValueInfoRadsMax = GetActorValueInfo(ActorValueInfo::kRadHealthMax);
     float valueRadsMax = actorValueOwner.GetValue(pActorValueInfoRadsMax);
-    actorValues.ActorValuesList.insert({ActorValueInfo::kRadHealthMax, valueRadsMax});
+    actorValues.ActorValuesList.Set(ActorValueInfo::kRadHealthMax, valueRadsMax);
 
     return actorValues;
 }
@@ -180,14 +180,14 @@ void Actor::ForceActorValue(ActorValueOwner::ForceMode aMode, uint32_t aId, floa
 
 void Actor::SetActorValues(const ActorValues& acActorValues) noexcept
 {
-    for (auto& value : acActorValues.ActorMaxValuesList)
+    for (const auto& value : acActorValues.ActorMaxValuesList)
     {
         ActorValueInfo* pActorValueInfo = GetActorValueInfo(value.first);
         float current = actorValueOwner.GetValue(pActorValueInfo);
         actorValueOwner.ForceCurrent(ActorValueOwner::ForceMode::PERMANENT, pActorValueInfo, value.second - current);
     }
 
-    for (auto& value : acActorValues.ActorValuesList)
+    for (const auto& value : acActorValues.ActorValuesList)
     {
         ActorValueInfo* pActorValueInfo = GetActorValueInfo(value.first);
         if (value.first == ActorValueInfo::kRads || value.first == ActorValueInfo::kRadHealthMax)
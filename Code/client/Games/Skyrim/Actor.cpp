@@ -274,9 +274,9 @@ ActorValues Actor::GetEssentialActorValues() const noexcept
     for (auto i : essentialValues)
     {
         float value = actorValueOwner.GetValue(i);
-        actorValues.ActorValuesList.insert({i, value});
+        actorValues.ActorValuesList.Set(i, value);
         float maxValue = actorValueOwner.GetPermanentValue(i);
-        actorValues.ActorMaxValuesList.insert({i, maxValue});
+        actorValues.ActorMaxValuesList.Set(i, maxValue);
     }
 
     return actorValues;
@@ -384,13 +384,13 @@ void Actor::SetMagicEquipment(const MagicEquipment& acEquipment) noexcept
 
 void Actor::SetActorValues(const ActorValues& acActorValues) noexcept
 {
-    for (auto& value : acActorValues.ActorMaxValuesList)
+    for (const auto& value : acActorValues.ActorMaxValuesList)
     {
         float current = actorValueOwner.GetValue(value.first);
         actorValueOwner.ForceCurrent(ActorValueOwner::ForceMode::PERMANENT, value.first, value.second - current);
     }
 
-    for (auto& value : acActorValues.ActorValuesList)
+    for (const auto& value : acActorValues.ActorValuesList)
     {
         float current = actorValueOwner.GetValue(value.first);
         actorValueOwner.ForceCurrent(ActorValueOwner::ForceMode::DAMAGE, value.first, value.second - current);
@@ -1,5 +1,6 @@
 #pragma once
 #include "Structs/Inventory.h"
+#include "Structs/Movement.h"
 
 struct ActorAddedEvent;
 struct ActorRemovedEvent;
@@ -11,6 +12,7 @@ struct FormIdComponent;
 struct ActionEvent;
 struct AssignCharacterResponse;
 struct CharacterSpawnRequest;
+struct CharacterSpawnBatchRequest;
 struct ServerReferencesMoveRequest;
 struct NotifyInventoryChanges;
 struct NotifyFactionsChanges;
@@ -63,14 +65,15 @@ struct CharacterService
     void OnActorRemoved(const ActorRemovedEvent& acEvent) noexcept;
     void OnUpdate(const UpdateEvent& acUpdateEvent) noexcept;
     void OnConnected(const ConnectedEvent& acConnectedEvent) const noexcept;
-    void OnDisconnected(const DisconnectedEvent& acDisconnectedEvent) const noexcept;
+    void OnDisconnected(const DisconnectedEvent& acDisconnectedEvent) noexcept;
     void OnAssignCharacter(const AssignCharacterResponse& acMessage) noexcept;
     void OnCharacterSpawn(const CharacterSpawnRequest& acMessage) const noexcept;
-    void OnReferencesMoveRequest(const ServerReferencesMoveRequest& acMessage) const noexcept;
+    void OnCharacterSpawnBatch(const CharacterSpawnBatchRequest& acMessage) const noexcept;
+    void OnReferencesMoveRequest(const ServerReferencesMoveRequest& acMessage) noexcept;
     void OnActionEvent(const ActionEvent& acActionEvent) const noexcept;
     void OnFactionsChanges(const NotifyFactionsChanges& acEvent) const noexcept;
     void OnOwnershipTransfer(const NotifyOwnershipTransfer& acMessage) const noexcept;
-    void OnRemoveCharacter(const NotifyRemoveCharacter& acMessage) const noexcept;
+    void OnRemoveCharacter(const NotifyRemoveCharacter& acMessage) noexcept;
     void OnRemoteSpawnDataReceived(const NotifySpawnData& acEvent) noexcept;
     void OnMountEvent(const MountEvent& acEvent) const noexcept;
     void OnNotifyMount(const NotifyMount& acMessage) const noexcept;
@@ -126,6 +129,8 @@ private:
     };
 
     Map<uint32_t, WeaponDrawData> m_weaponDrawUpdates{};
+    // Last movement received per server id, the server sends movement as deltas against it
+    Map<uint32_t, Movement> m_movementBaselines{};
 
     entt::scoped_connection m_referenceAddedConnection;
     entt::scoped_connection m_referenceRemovedConnection;
@@ -138,6 +143,7 @@ private:
     entt::scoped_connection m_disconnectedConnection;
     entt::scoped_connection m_assignCharacterConnection;
     entt::scoped_connection m_characterSpawnConnection;
+    entt::scoped_connection m_characterSpawnBatchConnection;
     entt::scoped_connection m_referenceMovementSnapshotConnection;
     entt::scoped_connection m_remoteSpawnDataReceivedConnection;
     entt::scoped_connection m_mountConnection;
@@ -52,9 +52,9 @@ void ActorValueService::CreateActorValuesComponent(const entt::entity aEntity, A
 #endif
 
         float value = apActor->GetActorValue(i);
-        actorValuesComponent.CurrentActorValues.ActorValuesList.insert({i, value});
+        actorValuesComponent.CurrentActorValues.ActorValuesList.Set(i, value);
         float maxValue = apActor->GetActorPermanentValue(i);
-        actorValuesComponent.CurrentActorValues.ActorMaxValuesList.insert({i, maxValue});
+        actorValuesComponent.CurrentActorValues.ActorMaxValuesList.Set(i, maxValue);
     }
 }
 
@@ -138,28 +138,28 @@ void ActorValueService::BroadcastActorValues() noexcept
                 continue;
 #endif
             float newValue = pActor->GetActorValue(i);
-            float oldValue = actorValuesComponent.CurrentActorValues.ActorValuesList[i];
+            float oldValue = actorValuesComponent.CurrentActorValues.ActorValuesList.Get(i);
             if (newValue != oldValue)
             {
-                requestValueChanges.Values.insert({i, newValue});
-                actorValuesComponent.CurrentActorValues.ActorValuesList[i] = newValue;
+                requestValueChanges.Values.Set(i, newValue);
+                actorValuesComponent.CurrentActorValues.ActorValuesList.Set(i, newValue);
             }
 
             float newMaxValue = pActor->GetActorPermanentValue(i);
-            float oldMaxValue = actorValuesComponent.CurrentActorValues.ActorMaxValuesList[i];
+            float oldMaxValue = actorValuesComponent.CurrentActorValues.ActorMaxValuesList.Get(i);
             if (newMaxValue != oldMaxValue)
             {
-                requestValueChanges.Values.insert({i, newValue});
-                actorValuesComponent.CurrentActorValues.ActorMaxValuesList[i] = newMaxValue;
+                requestValueChanges.Values.Set(i, newValue);
+                actorValuesComponent.CurrentActorValues.ActorMaxValuesList.Set(i, newMaxValue);
             }
         }
 
-        if (requestValueChanges.Values.size() > 0)
+        if (!requestValueChanges.Values.Empty())
         {
             m_transport.Send(requestValueChanges);
         }
 
-        if (requestMaxValueChanges.Values.size() > 0)
+        if (!requestMaxValueChanges.Values.Empty())
         {
             m_transport.Send(requestMaxValueChanges);
         }
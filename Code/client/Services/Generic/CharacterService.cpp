@@ -41,6 +41,7 @@
 #include <Messages/ServerReferencesMoveRequest.h>
 #include <Messages/ClientReferencesMoveRequest.h>
 #include <Messages/CharacterSpawnRequest.h>
+#include <Messages/CharacterSpawnBatchRequest.h>
 #include <Messages/RequestFactionsChanges.h>
 #include <Messages/NotifyFactionsChanges.h>
 #include <Messages/NotifyRemoveCharacter.h>
@@ -83,6 +84,7 @@ CharacterService::CharacterService(World& aWorld, entt::dispatcher& aDispatcher,
 
     m_assignCharacterConnection = m_dispatcher.sink<AssignCharacterResponse>().connect<&CharacterService::OnAssignCharacter>(this);
     m_characterSpawnConnection = m_dispatcher.sink<CharacterSpawnRequest>().connect<&CharacterService::OnCharacterSpawn>(this);
+    m_characterSpawnBatchConnection = m_dispatcher.sink<CharacterSpawnBatchRequest>().connect<&CharacterService::OnCharacterSpawnBatch>(this);
     m_referenceMovementSnapshotConnection = m_dispatcher.sink<ServerReferencesMoveRequest>().connect<&CharacterService::OnReferencesMoveRequest>(this);
     m_factionsConnection = m_dispatcher.sink<NotifyFactionsChanges>().connect<&CharacterService::OnFactionsChanges>(this);
     m_ownershipTransferConnection = m_dispatcher.sink<NotifyOwnershipTransfer>().connect<&CharacterService::OnOwnershipTransfer>(this);
@@ -264,7 +266,7 @@ void CharacterService::OnConnected(const ConnectedEvent& acConnectedEvent) const
     }
 }
 
-void CharacterService::OnDisconnected(const DisconnectedEvent& acDisconnectedEvent) const noexcept
+void CharacterService::OnDisconnected(const DisconnectedEvent& acDisconnectedEvent) noexcept
 {
     auto remoteView = m_world.view<FormIdComponent, RemoteComponent>();
     for (auto entity : remoteView)
@@ -282,6 +284,8 @@ void CharacterService::OnDisconnected(const DisconnectedEvent& acDisconnectedEve
     }
 
     m_world.clear<WaitingForAssignmentComponent, LocalComponent, RemoteComponent>();
+
+    m_movementBaselines.clear();
 }
 
 void CharacterService::OnAssignCharacter(const AssignCharacterResponse& acMessage) noexcept
@@ -549,12 +553,22 @@ void CharacterService::OnRemoteSpawnDataReceived(const NotifySpawnData& acMessag
     spdlog::info("Applied remote spawn data, actor form id: {:X}", pActor->formID);
 }
 
-void CharacterService::OnReferencesMoveRequest(const ServerReferencesMoveRequest& acMessage) const noexcept
+void CharacterService::OnCharacterSpawnBatch(const CharacterSpawnBatchRequest& acMessage) const noexcept
+{
+    for (const auto& spawn : acMessage.Spawns)
+        OnCharacterSpawn(spawn);
+}
+
+void CharacterService::OnReferencesMoveRequest(const ServerReferencesMoveRequest& acMessage) noexcept
 {
     auto view = m_world.view<RemoteComponent, InterpolationComponent, RemoteAnimationComponent>();
 
     for (const auto& [serverId, update] : acMessage.Updates)
     {
+        // Apply the delta even if the reference is not spawned yet, the server assumes we are in sync
+        auto& movement = m_movementBaselines[serverId];
+        update.UpdatedMovement.Apply(movement);
+
         auto itor = std::find_if(std::begin(view), std::end(view), [serverId = serverId, view](entt::entity entity) { return view.get<RemoteComponent>(entity).Id == serverId; });
 
         if (itor == std::end(view))
@@ -562,7 +576,6 @@ void CharacterService::OnReferencesMoveRequest(const ServerReferencesMoveRequest
 
         auto& interpolationComponent = view.get<InterpolationComponent>(*itor);
         auto& animationComponent = view.get<RemoteAnimationComponent>(*itor);
-        const auto& movement = update.UpdatedMovement;
 
         InterpolationComponent::TimePoint point;
         point.Tick = acMessage.Tick;
@@ -644,8 +657,11 @@ void CharacterService::OnOwnershipTransfer(const NotifyOwnershipTransfer& acMess
     m_transport.Send(request);
 }
 
-void CharacterService::OnRemoveCharacter(const NotifyRemoveCharacter& acMessage) const noexcept
+void CharacterService::OnRemoveCharacter(const NotifyRemoveCharacter& acMessage) noexcept
 {
+    // The server no longer sends movement for a removed character, a new one starts from a keyframe
+    m_movementBaselines.erase(acMessage.ServerId);
+
     auto view = m_world.view<RemoteComponent>();
 
     const auto itor = std::find_if(std::begin(view), std::end(view), [id = acMessage.ServerId, view](entt::entity entity) { return view.get<RemoteComponent>(entity).Id == id; });
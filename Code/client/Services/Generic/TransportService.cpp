@@ -61,6 +61,14 @@ TransportService::TransportService(World& aWorld, entt::dispatcher& aDispatcher)
         const auto pRealMessage = TiltedPhoques::CastUnique<AuthenticationResponse>(std::move(apMessage));
         HandleAuthenticationResponse(*pRealMessage);
     };
+
+    // Bundles only frame other messages, dispatch them in order
+    m_messageHandlers[NotifyMessageBundle::Opcode] = [this](UniquePtr<ServerMessage>& apMessage)
+    {
+        const auto pBundle = TiltedPhoques::CastUnique<NotifyMessageBundle>(std::move(apMessage));
+        for (auto& pMessage : pBundle->Messages)
+            m_messageHandlers[pMessage->GetOpcode()](pMessage);
+    };
 }
 
 bool TransportService::Send(const ClientMessage& acMessage) const noexcept
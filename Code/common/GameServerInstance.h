@@ -14,4 +14,6 @@ public:
 
     // update the server logic
     virtual void Update() = 0;
+    // block until the server has work to do
+    virtual void WaitForNextTick() = 0;
 };
@@ -1,8 +1,12 @@
 
 
 #include "ESLoader.h"
+#include "RecordCache.h"
+#include <atomic>
+#include <chrono>
 #include <filesystem>
 #include <fstream>
+#include <thread>
 
 #include <Records/CLMT.h>
 #include <Records/NPC.h>
@@ -29,6 +33,7 @@ String ReadWString(Buffer::Reader& aReader) noexcept
 ESLoader::ESLoader()
 {
     m_directory = fs::current_path() / "Data"; //< Keep upper case to match Skyrim's file system
+    m_cachePath = fs::current_path() / "records.cache";
 }
 
 UniquePtr<RecordCollection> ESLoader::BuildRecordCollection() noexcept
@@ -44,14 +49,43 @@ UniquePtr<RecordCollection> ESLoader::BuildRecordCollection() noexcept
         return nullptr;
     }
 
-    return MakeUnique<RecordCollection>();
+    // Resolved once, the indexing workers only read it
+    const auto cDataFiles = ListDataFiles();
 
-    /*
-    auto recordCollection = LoadFiles();
+    // The cache is keyed by every plugin of the load order, if one cannot be read the cache is not used at all
+    Vector<RecordCache::PluginKey> cacheKeys;
+    for (const auto& plugin : m_loadOrder)
+    {
+        const auto pathItor = cDataFiles.find(plugin.m_filename);
+        if (pathItor == std::end(cDataFiles) || !RecordCache::BuildKey(plugin.m_filename, pathItor->second, cacheKeys.emplace_back()))
+        {
+            cacheKeys.clear();
+            break;
+        }
+    }
+
+    if (!cacheKeys.empty())
+    {
+        const auto cStart = std::chrono::steady_clock::now();
+
+        if (auto recordCollection = RecordCache::Load(m_cachePath, cacheKeys, cDataFiles))
+        {
+            recordCollection->BuildReferences();
+
+            const auto cDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - cStart);
+            spdlog::info("Loaded records of {} plugins from the cache in {} ms", m_loadOrder.size(), cDuration.count());
+
+            return recordCollection;
+        }
+    }
+
+    auto recordCollection = LoadFiles(cDataFiles);
     recordCollection->BuildReferences();
 
-    return std::move(recordCollection);
-    */
+    if (!cacheKeys.empty())
+        RecordCache::Save(m_cachePath, cacheKeys, *recordCollection);
+
+    return recordCollection;
 }
 
 bool ESLoader::LoadLoadOrder()
@@ -72,15 +106,17 @@ bool ESLoader::LoadLoadOrder()
     {
         String line;
         std::getline(loadOrderFile, line);
-        if (line[0] == '#' || line.empty())
+
+        // On Linux, the carriage return won't be taken into account
+        line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
+
+        // Checked after the carriage return is gone, a blank CRLF line is empty only then
+        if (line.empty() || line[0] == '#')
             continue;
 
         PluginData plugin;
         plugin.m_filename = line;
 
-        // On Linux, the carriage return won't be taken into account
-        line.erase(std::remove(line.begin(), line.end(), '\r'), line.end());
-
         char extensionType = line.back();
 
         switch (extensionType)
@@ -105,46 +141,85 @@ bool ESLoader::LoadLoadOrder()
     return true;
 }
 
-UniquePtr<RecordCollection> ESLoader::LoadFiles()
+UniquePtr<RecordCollection> ESLoader::LoadFiles(const Map<String, fs::path>& acDataFiles)
 {
-    auto recordCollection = MakeUnique<RecordCollection>();
+    const auto cStart = std::chrono::steady_clock::now();
+
+    Vector<UniquePtr<RecordCollection>> plugins(m_loadOrder.size());
+    std::atomic<size_t> nextPlugin{0};
 
-    for (PluginData& plugin : m_loadOrder)
+    const auto worker = [&]()
     {
-        fs::path pluginPath = GetPath(plugin.m_filename);
-        if (pluginPath.empty())
+        for (auto i = nextPlugin.fetch_add(1); i < m_loadOrder.size(); i = nextPlugin.fetch_add(1))
         {
-            spdlog::warn("Path to plugin file not found: {}", plugin.m_filename);
-            continue;
+            const auto& plugin = m_loadOrder[i];
+
+            const auto pathItor = acDataFiles.find(plugin.m_filename);
+            if (pathItor == std::end(acDataFiles))
+            {
+                spdlog::warn("Path to plugin file not found: {}", plugin.m_filename);
+                continue;
+            }
+
+            plugins[i] = LoadFile(plugin, pathItor->second);
         }
+    };
+
+    const size_t threadCount = std::min<size_t>(std::max(std::thread::hardware_concurrency(), 1u), m_loadOrder.size());
 
-        TESFile pluginFile(m_masterFiles);
-        if (plugin.IsLite())
-            pluginFile.Setup(plugin.m_liteId);
-        else
-            pluginFile.Setup(plugin.m_standardId);
+    Vector<std::thread> threads;
+    for (size_t i = 1; i < threadCount; ++i)
+        threads.emplace_back(worker);
 
-        bool loadResult = pluginFile.LoadFile(pluginPath);
+    worker();
 
-        if (!loadResult)
+    for (auto& thread : threads)
+        thread.join();
+
+    // Merging in load order gives the same overrides as indexing the plugins one after the other
+    auto recordCollection = MakeUnique<RecordCollection>();
+    for (auto& pPlugin : plugins)
+    {
+        if (!pPlugin)
             continue;
 
-        pluginFile.IndexRecords(*recordCollection);
+        recordCollection->Merge(std::move(*pPlugin));
+        pPlugin.reset();
     }
 
+    // Sorted once for the whole load order, overrides are dropped there
+    recordCollection->Seal();
+
+    const auto cDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - cStart);
+    spdlog::info("Indexed {} plugins in {} ms on {} threads", m_loadOrder.size(), cDuration.count(), threads.size() + 1);
+
     return recordCollection;
 }
 
-fs::path ESLoader::GetPath(String& aFilename)
+UniquePtr<RecordCollection> ESLoader::LoadFile(const PluginData& acPlugin, const fs::path& acPath) const noexcept
 {
+    TESFile pluginFile(m_masterFiles);
+    if (acPlugin.IsLite())
+        pluginFile.Setup(acPlugin.m_liteId);
+    else
+        pluginFile.Setup(acPlugin.m_standardId);
+
+    if (!pluginFile.LoadFile(acPath))
+        return nullptr;
+
+    auto recordCollection = MakeUnique<RecordCollection>();
+    pluginFile.IndexRecords(*recordCollection);
+
+    return recordCollection;
+}
+
+Map<String, fs::path> ESLoader::ListDataFiles() const
+{
+    Map<String, fs::path> files;
     for (const auto& entry : fs::directory_iterator(m_directory))
-    {
-        String filename = entry.path().filename().string().c_str();
-        if (filename == aFilename)
-            return entry.path();
-    }
+        files[entry.path().filename().string().c_str()] = entry.path();
 
-    return fs::path();
+    return files;
 }
 
 } // namespace ESLoader
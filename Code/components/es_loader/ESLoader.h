@@ -27,6 +27,8 @@ String ReadWString(Buffer::Reader& aReader) noexcept;
 
 class ESLoader
 {
+    friend class LoadOrderTest;
+
 public:
     ESLoader();
 
@@ -36,11 +38,17 @@ public:
 
 private:
     bool LoadLoadOrder();
-    UniquePtr<RecordCollection> LoadFiles();
+    /**
+     * @brief Indexes the plugins on a worker pool, each into its own collection, then merges them in load order.
+     */
+    UniquePtr<RecordCollection> LoadFiles(const Map<String, fs::path>& acDataFiles);
+    [[nodiscard]] UniquePtr<RecordCollection> LoadFile(const PluginData& acPlugin, const fs::path& acPath) const noexcept;
 
-    fs::path GetPath(String& aFilename);
+    // Maps the file names of the data directory to their path
+    [[nodiscard]] Map<String, fs::path> ListDataFiles() const;
 
     fs::path m_directory = "";
+    fs::path m_cachePath = "";
     Vector<PluginData> m_loadOrder{};
     TiltedPhoques::Map<String, uint8_t> m_masterFiles{};
 };
@@ -1,28 +1,72 @@
 #include <gtest/gtest.h>
 #include <ESLoader.h>
+#include <NavMeshQuery.h>
+#include <RecordCache.h>
 
+#include <Records/NAVM.h>
 #include <Records/NPC.h>
 
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <random>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <unistd.h>
+#endif
+
 // To properly run these tests, move your Skyrim Data\ dir to the binary's dir,
 // along with a loadorder.txt in the Data\ dir
 namespace
 {
 
+// Resident set size of the process, mapped plugin pages that were touched included
+size_t GetResidentMemory()
+{
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters{};
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+
+    return counters.WorkingSetSize;
+#else
+    size_t totalPages = 0;
+    size_t residentPages = 0;
+
+    std::ifstream statm("/proc/self/statm");
+    if (!(statm >> totalPages >> residentPages))
+        return 0;
+
+    return residentPages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+#endif
+}
+
 class ESLoaderTest : public ::testing::Test
 {
 public:
     static void SetUpTestSuite()
     {
+        s_residentBeforeLoad = GetResidentMemory();
+
         ESLoader::ESLoader loader;
         s_collection = loader.BuildRecordCollection();
+
+        s_residentAfterLoad = GetResidentMemory();
     }
 
     UniquePtr<ESLoader::RecordCollection>& GetCollection() { return s_collection; }
 
     static UniquePtr<ESLoader::RecordCollection> s_collection;
+    static size_t s_residentBeforeLoad;
+    static size_t s_residentAfterLoad;
 };
 
 UniquePtr<ESLoader::RecordCollection> ESLoaderTest::s_collection = nullptr;
+size_t ESLoaderTest::s_residentBeforeLoad = 0;
+size_t ESLoaderTest::s_residentAfterLoad = 0;
 
 TEST_F(ESLoaderTest, BuildRecordCollection)
 {
@@ -34,7 +78,9 @@ TEST_F(ESLoaderTest, GetMapMarkerLandmark)
 {
     auto& pCollection = ESLoaderTest::GetCollection();
 
-    REFR& mapMarker = pCollection->GetObjectRefById(0x105F3A);
+    const REFR* pMapMarker = pCollection->GetObjectRefById(0x105F3A);
+    ASSERT_NE(pMapMarker, nullptr);
+    const REFR& mapMarker = *pMapMarker;
 
     EXPECT_EQ(mapMarker.m_basicObject.m_baseId, 0x10);
     EXPECT_TRUE(mapMarker.m_markerData.m_isMarker);
@@ -45,7 +91,9 @@ TEST_F(ESLoaderTest, GetNpcFaendal)
 {
     auto& pCollection = ESLoaderTest::GetCollection();
 
-    NPC& faendal = pCollection->GetNpcById(0x13480);
+    const NPC* pFaendal = pCollection->GetNpcById(0x13480);
+    ASSERT_NE(pFaendal, nullptr);
+    const NPC& faendal = *pFaendal;
 
     EXPECT_EQ(faendal.m_editorId, "Faendal");
     EXPECT_TRUE(faendal.m_baseStats.IsUnique());
@@ -59,7 +107,9 @@ TEST_F(ESLoaderTest, GetNpcDlcSerana)
 {
     auto& pCollection = ESLoaderTest::GetCollection();
 
-    NPC& serana = pCollection->GetNpcById(0x2002B6C);
+    const NPC* pSerana = pCollection->GetNpcById(0x2002B6C);
+    ASSERT_NE(pSerana, nullptr);
+    const NPC& serana = *pSerana;
 
     EXPECT_EQ(serana.m_editorId, "DLC1Serana");
     EXPECT_EQ(serana.m_defaultOutfit.m_formId, 0x2016903);
@@ -69,7 +119,9 @@ TEST_F(ESLoaderTest, GetContainerPersonalChest)
 {
     auto& pCollection = ESLoaderTest::GetCollection();
 
-    CONT& chest = pCollection->GetContainerById(0x9AF19);
+    const CONT* pChest = pCollection->GetContainerById(0x9AF19);
+    ASSERT_NE(pChest, nullptr);
+    const CONT& chest = *pChest;
 
     EXPECT_EQ(chest.m_editorId, "PersonalChestSmall");
     EXPECT_EQ(chest.m_objects.size(), 7);
@@ -81,7 +133,9 @@ TEST_F(ESLoaderTest, GetClimateDlcApocrypha)
 {
     auto& pCollection = ESLoaderTest::GetCollection();
 
-    CLMT& climate = pCollection->GetClimateById(0x401C48E);
+    const CLMT* pClimate = pCollection->GetClimateById(0x401C48E);
+    ASSERT_NE(pClimate, nullptr);
+    const CLMT& climate = *pClimate;
 
     EXPECT_EQ(climate.m_editorId, "DLC2ApocryphaClimate");
     EXPECT_EQ(climate.m_weatherList.m_weatherId, 0x4034CFB);
@@ -101,7 +155,9 @@ TEST_F(ESLoaderTest, GetGameSettingFloatBribeScale)
 {
     auto& pCollection = ESLoaderTest::GetCollection();
 
-    GMST& bribeSetting = pCollection->GetGameSettingById(0xE63);
+    const GMST* pBribeSetting = pCollection->GetGameSettingById(0xE63);
+    ASSERT_NE(pBribeSetting, nullptr);
+    const GMST& bribeSetting = *pBribeSetting;
 
     EXPECT_EQ(bribeSetting.m_editorId, "fBribeScale");
     EXPECT_EQ(bribeSetting.m_value.m_type, Chunks::TypedValue::TYPE::FLOAT);
@@ -112,10 +168,487 @@ TEST_F(ESLoaderTest, GetWorldTamriel)
 {
     const auto& pCollection = GetCollection();
 
-    const WRLD& tamrielWorld = pCollection->GetWorldById(60);
+    const WRLD* pTamrielWorld = pCollection->GetWorldById(60);
+    ASSERT_NE(pTamrielWorld, nullptr);
+    const WRLD& tamrielWorld = *pTamrielWorld;
 
     EXPECT_EQ(tamrielWorld.m_editorId, "Tamriel");
     EXPECT_EQ(tamrielWorld.m_navMeshRefs.size(), 0x3315);
 }
 
+TEST_F(ESLoaderTest, MissingRecordsAreNotAdded)
+{
+    auto& pCollection = ESLoaderTest::GetCollection();
+
+    const size_t cNpcCount = pCollection->GetNpcCount();
+    const size_t cObjectRefCount = pCollection->GetObjectRefCount();
+    const size_t cContainerCount = pCollection->GetContainers().Size();
+    const size_t cFormCount = pCollection->GetFormTypes().Size();
+
+    EXPECT_EQ(pCollection->GetNpcById(0xFE000FFF), nullptr);
+    EXPECT_EQ(pCollection->GetNpcById(0xFE000FFF), nullptr);
+    EXPECT_EQ(pCollection->GetObjectRefById(0xFE000FFF), nullptr);
+    EXPECT_EQ(pCollection->GetContainerById(0x13480), nullptr);
+    EXPECT_EQ(pCollection->GetFormType(0xFE000FFF), FormEnum::EMPTY_ID);
+
+    EXPECT_EQ(pCollection->GetNpcCount(), cNpcCount);
+    EXPECT_EQ(pCollection->GetObjectRefCount(), cObjectRefCount);
+    EXPECT_EQ(pCollection->GetContainers().Size(), cContainerCount);
+    EXPECT_EQ(pCollection->GetFormTypes().Size(), cFormCount);
+}
+
+// Run with --gtest_also_run_disabled_tests
+// Resident memory after load is the figure to compare with the map based collection, table usage leaves out what
+// records allocate and the mapped plugins
+TEST_F(ESLoaderTest, DISABLED_LookupBenchmark)
+{
+    auto& pCollection = ESLoaderTest::GetCollection();
+
+    constexpr size_t kLookups = 10'000'000;
+    constexpr size_t kSamples = 1 << 16;
+
+    // Ids sampled from the load order, every other one is moved past the last record of its plugin to get a miss
+    const auto& formTypes = pCollection->GetFormTypes();
+    Vector<uint32_t> anyIds, objectRefIds, npcIds;
+    for (size_t i = 0; i < formTypes.Size(); ++i)
+    {
+        anyIds.push_back(formTypes.GetId(i));
+
+        if (formTypes.GetRecord(i) == FormEnum::REFR)
+            objectRefIds.push_back(formTypes.GetId(i));
+        else if (formTypes.GetRecord(i) == FormEnum::NPC_)
+            npcIds.push_back(formTypes.GetId(i));
+    }
+
+    ASSERT_FALSE(objectRefIds.empty());
+    ASSERT_FALSE(npcIds.empty());
+
+    std::mt19937 random(42);
+    const auto Sample = [&](const Vector<uint32_t>& acIds) {
+        std::uniform_int_distribution<size_t> distribution(0, acIds.size() - 1);
+
+        Vector<uint32_t> formIds(kSamples);
+        for (size_t i = 0; i < formIds.size(); ++i)
+        {
+            formIds[i] = acIds[distribution(random)];
+            if (i & 1)
+                formIds[i] |= 0x00FFF000;
+        }
+
+        return formIds;
+    };
+
+    const auto Measure = [&](const char* acpName, const Vector<uint32_t>& acFormIds, auto&& aLookup) {
+        size_t hits = 0;
+        const auto cStart = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kLookups; ++i)
+            hits += aLookup(acFormIds[i & (kSamples - 1)]);
+
+        const auto cSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+        std::printf("%s: %.1f M lookups/s (%zu hits)\n", acpName, kLookups / cSeconds / 1e6, hits);
+    };
+
+    // Misses are logged as errors by GetFormType
+    const auto cLevel = spdlog::get_level();
+    spdlog::set_level(spdlog::level::off);
+    Measure("GetFormType", Sample(anyIds), [&](uint32_t aFormId) { return pCollection->GetFormType(aFormId) != FormEnum::EMPTY_ID; });
+    spdlog::set_level(cLevel);
+
+    // Parses the sampled records on the first pass, then only finds them
+    Measure("GetObjectRefById", Sample(objectRefIds), [&](uint32_t aFormId) { return pCollection->GetObjectRefById(aFormId) != nullptr; });
+    Measure("GetNpcById", Sample(npcIds), [&](uint32_t aFormId) { return pCollection->GetNpcById(aFormId) != nullptr; });
+
+    std::printf("Resident memory: %.1f MiB before load, %.1f MiB after load, %.1f MiB now; tables use %.1f MiB\n",
+                s_residentBeforeLoad / (1024.0 * 1024.0), s_residentAfterLoad / (1024.0 * 1024.0), GetResidentMemory() / (1024.0 * 1024.0),
+                pCollection->GetTableMemoryUsage() / (1024.0 * 1024.0));
+}
+
+// Run with --gtest_also_run_disabled_tests
+TEST_F(ESLoaderTest, DISABLED_NavMeshQueryBenchmark)
+{
+    auto& pCollection = ESLoaderTest::GetCollection();
+
+    const WRLD* pTamriel = pCollection->GetWorldById(60);
+    ASSERT_NE(pTamriel, nullptr);
+
+    const auto cBuildStart = std::chrono::steady_clock::now();
+    const ESLoader::NavMeshQuery query(pTamriel->m_navMeshRefs);
+    const auto cBuildSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - cBuildStart).count();
+
+    std::printf("Built %zu triangles, %zu nodes, %u islands in %.3f s, %.1f MiB\n", query.GetTriangleCount(), query.GetNodeCount(),
+                query.GetIslandCount(), cBuildSeconds, query.GetMemoryUsage() / (1024.0 * 1024.0));
+
+    constexpr size_t kQueries = 1'000'000;
+
+    // Positions over the playable part of Tamriel, which spans roughly 64 cells of 4096 units each way
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> horizontal(-131072.f, 131072.f);
+    std::uniform_real_distribution<float> vertical(-4096.f, 16384.f);
+
+    Vector<glm::vec3> positions(1 << 16);
+    for (auto& position : positions)
+        position = {horizontal(random), horizontal(random), vertical(random)};
+
+    const auto Measure = [&](const char* acpName, auto&& aQuery) {
+        size_t hits = 0;
+        const auto cStart = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kQueries; ++i)
+            hits += aQuery(positions[i & (positions.size() - 1)], positions[(i + 1) & (positions.size() - 1)]);
+
+        const auto cSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - cStart).count();
+        std::printf("%s: %.2f M queries/s (%zu hits)\n", acpName, kQueries / cSeconds / 1e6, hits);
+    };
+
+    Measure("Nearest within 512", [&](const glm::vec3& acPosition, const glm::vec3&) { return query.FindNearest(acPosition, 512.f).has_value(); });
+    Measure("Ground height", [&](const glm::vec3& acPosition, const glm::vec3&) {
+        return query.GetGroundHeight(acPosition.x, acPosition.y, acPosition.z).has_value();
+    });
+    Measure("Reachable within 4096", [&](const glm::vec3& acFrom, const glm::vec3& acTo) {
+        const auto cFrom = query.FindNearest(acFrom, 4096.f);
+        const auto cTo = query.FindNearest(acTo, 4096.f);
+        return cFrom && cTo && query.IsReachable(cFrom->Triangle, cTo->Triangle);
+    });
+}
+
+// A square of two triangles, 100 units wide, at the given corner
+NAVM MakeSquareNavMesh(uint32_t aFormId, const glm::vec3& acCorner)
+{
+    NAVM navMesh{};
+    navMesh.SetBaseId(aFormId);
+
+    auto& mesh = navMesh.m_navMesh;
+    mesh.m_vertices = {acCorner, acCorner + glm::vec3(100.f, 0.f, 0.f), acCorner + glm::vec3(100.f, 100.f, 0.f), acCorner + glm::vec3(0.f, 100.f, 0.f)};
+    mesh.m_triangles = {{0, 1, 2, -1, -1, 1, 0, 0}, {0, 2, 3, 0, -1, -1, 0, 0}};
+
+    return navMesh;
+}
+
+TEST(NavMeshQueryTest, Queries)
+{
+    NAVM first = MakeSquareNavMesh(0x100, {0.f, 0.f, 0.f});
+    NAVM second = MakeSquareNavMesh(0x200, {100.f, 0.f, 50.f});
+    NAVM island = MakeSquareNavMesh(0x300, {1000.f, 1000.f, 0.f});
+
+    // Edge 1 of the first triangle is linked to the first triangle of the second navmesh
+    first.m_navMesh.m_connections.push_back({0, 0x200, 0});
+    first.m_navMesh.m_triangles[0].m_edge1 = 0;
+    first.m_navMesh.m_triangles[0].m_coverMarker = 0x2;
+
+    const ESLoader::NavMeshQuery query(Vector<NAVM const*>{&first, &second, &island});
+
+    ASSERT_EQ(query.GetTriangleCount(), 6);
+    EXPECT_EQ(query.GetIslandCount(), 2);
+
+    const auto cStart = query.FindNearest({50.f, 50.f, 10.f}, 100.f);
+    ASSERT_TRUE(cStart);
+    EXPECT_FLOAT_EQ(cStart->Distance, 10.f);
+    EXPECT_FLOAT_EQ(cStart->Position.z, 0.f);
+
+    const auto cLinked = query.FindNearest({150.f, 50.f, 50.f}, 100.f);
+    const auto cIsland = query.FindNearest({1050.f, 1050.f, 0.f}, 100.f);
+    ASSERT_TRUE(cLinked);
+    ASSERT_TRUE(cIsland);
+    EXPECT_TRUE(query.IsReachable(cStart->Triangle, cLinked->Triangle));
+    EXPECT_FALSE(query.IsReachable(cStart->Triangle, cIsland->Triangle));
+
+    EXPECT_FALSE(query.FindNearest({500.f, 500.f, 0.f}, 100.f));
+
+    EXPECT_EQ(query.GetGroundHeight(150.f, 50.f, 1000.f), 50.f);
+    EXPECT_EQ(query.GetGroundHeight(150.f, 50.f, 10.f), std::nullopt);
+    EXPECT_EQ(query.GetGroundHeight(50.f, 50.f, 10.f), 0.f);
+}
+
+TEST(RecordTableTest, LaterRecordsOverrideEarlierOnes)
+{
+    ESLoader::RecordTable<uint32_t> table;
+    table.Add(0x01000010, 1);
+    table.Add(0x00000020, 2);
+    table.Add(0x00000010, 3);
+
+    ESLoader::RecordTable<uint32_t> plugin;
+    plugin.Add(0x00000020, 4);
+    plugin.Add(0x02000001, 5);
+
+    table.Append(std::move(plugin));
+    table.Seal();
+
+    ASSERT_EQ(table.Size(), 4);
+    EXPECT_EQ(*table.Find(0x00000010), 3);
+    EXPECT_EQ(*table.Find(0x00000020), 4);
+    EXPECT_EQ(*table.Find(0x01000010), 1);
+    EXPECT_EQ(*table.Find(0x02000001), 5);
+    EXPECT_EQ(table.Find(0x00000011), nullptr);
+    EXPECT_EQ(table.Find(0xFF000010), nullptr);
+    EXPECT_EQ(table.Size(), 4);
+}
+
 } // namespace
+
+namespace ESLoader
+{
+// Tables are filled by the loaders only, the fixture builds a small collection by hand
+class RecordCacheTest : public ::testing::Test
+{
+public:
+    static constexpr uint32_t kNpcId = 0x01000800;
+
+    void SetUp() override
+    {
+        const auto cDirectory = std::filesystem::temp_directory_path();
+        m_cachePath = cDirectory / "ESLoaderTest.cache";
+        m_pluginPath = cDirectory / "ESLoaderTest.esp";
+
+        // Only mapped again on load, the lazy records pointing into it are never parsed
+        {
+            std::ofstream plugin(m_pluginPath, std::ios::binary | std::ios::trunc);
+            const Vector<char> cBytes(256, 'P');
+            plugin.write(cBytes.data(), cBytes.size());
+        }
+
+        m_dataFiles["ESLoaderTest.esp"] = m_pluginPath;
+        ASSERT_TRUE(RecordCache::BuildKey("ESLoaderTest.esp", m_pluginPath, m_loadOrder.emplace_back()));
+    }
+
+    void TearDown() override
+    {
+        std::error_code error;
+        std::filesystem::remove(m_cachePath, error);
+        std::filesystem::remove(m_pluginPath, error);
+    }
+
+    static UniquePtr<RecordCollection> MakeCollection()
+    {
+        auto pCollection = MakeUnique<RecordCollection>();
+        auto& collection = *pCollection;
+
+        PluginFile plugin;
+        plugin.Name = "ESLoaderTest.esp";
+        plugin.FormIdPrefix = 0x01000000;
+        plugin.FormIdPrefixes[0] = 0;
+        plugin.FormIdPrefixes[1] = 0x01000000;
+        collection.m_plugins.push_back(std::move(plugin));
+
+        GMST bribeSetting{};
+        bribeSetting.SetBaseId(0xE63);
+        bribeSetting.m_editorId = "fBribeScale";
+        bribeSetting.m_value.m_type = Chunks::TypedValue::TYPE::FLOAT;
+        bribeSetting.m_value.m_float = 0.5f;
+        collection.m_gameSettings.Add(0xE63, std::move(bribeSetting));
+        collection.m_formTypes.Add(0xE63, FormEnum::GMST);
+
+        WRLD world{};
+        world.SetBaseId(0x3C);
+        world.m_editorId = "Tamriel";
+        world.m_centerCell = Chunks::WCTR{};
+        world.m_centerCell->m_x = -3;
+        world.m_centerCell->m_y = 7;
+        world.m_climateId = 0x01000D62;
+        world.m_musicId = 0;
+        world.m_lodMultiplier = 1.5f;
+        collection.m_worlds.Add(0x3C, std::move(world));
+        collection.m_formTypes.Add(0x3C, FormEnum::WRLD);
+
+        CONT chest{};
+        chest.SetBaseId(0x01000D62);
+        chest.m_editorId = "PersonalChest";
+        chest.m_name = "Chest";
+        chest.m_objects.resize(2);
+        chest.m_objects[0].m_formId = 0xF;
+        chest.m_objects[0].m_count = 100;
+        chest.m_objects[1].m_formId = 0x01000010;
+        chest.m_objects[1].m_count = 1;
+        collection.m_containers.Add(0x01000D62, std::move(chest));
+        collection.m_formTypes.Add(0x01000D62, FormEnum::CONT);
+
+        NAVM navMesh = MakeSquareNavMesh(0x01000100, {0.f, 0.f, 0.f});
+        navMesh.m_navMesh.m_worldSpaceId = 0x3C;
+        navMesh.m_navMesh.m_connections.push_back({0, 0x01000200, 1});
+        collection.m_navMeshes.Add(0x01000100, std::move(navMesh));
+        collection.m_formTypes.Add(0x01000100, FormEnum::NAVM);
+
+        LazyRecord<NPC> npc;
+        npc.Plugin = 0;
+        npc.Offset = 128;
+        collection.m_npcs.Add(kNpcId, std::move(npc));
+        collection.m_formTypes.Add(kNpcId, FormEnum::NPC_);
+
+        collection.Seal();
+        collection.BuildReferences();
+
+        return pCollection;
+    }
+
+    static const LazyRecord<NPC>* FindNpc(const RecordCollection& acCollection, uint32_t aFormId) { return acCollection.m_npcs.Find(aFormId); }
+
+    Vector<char> ReadCache() const
+    {
+        std::ifstream file(m_cachePath, std::ios::binary);
+        return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+    }
+
+    void WriteCache(const Vector<char>& acBytes, size_t aSize) const
+    {
+        std::ofstream file(m_cachePath, std::ios::binary | std::ios::trunc);
+        file.write(acBytes.data(), aSize);
+    }
+
+    std::filesystem::path m_cachePath;
+    std::filesystem::path m_pluginPath;
+    Vector<RecordCache::PluginKey> m_loadOrder;
+    Map<String, std::filesystem::path> m_dataFiles;
+};
+
+TEST_F(RecordCacheTest, RoundTrip)
+{
+    ASSERT_TRUE(RecordCache::Save(m_cachePath, m_loadOrder, *MakeCollection()));
+
+    auto pCollection = RecordCache::Load(m_cachePath, m_loadOrder, m_dataFiles);
+    ASSERT_TRUE(pCollection);
+    pCollection->BuildReferences();
+
+    EXPECT_EQ(pCollection->GetFormTypes().Size(), 5);
+    EXPECT_EQ(pCollection->GetFormType(kNpcId), FormEnum::NPC_);
+    EXPECT_EQ(pCollection->GetFormIdPrefix("ESLoaderTest.esp"), 0x01000000);
+
+    const GMST* pBribeSetting = pCollection->GetGameSettingById(0xE63);
+    ASSERT_NE(pBribeSetting, nullptr);
+    EXPECT_EQ(pBribeSetting->GetFormId(), 0xE63);
+    EXPECT_EQ(pBribeSetting->m_editorId, "fBribeScale");
+    EXPECT_EQ(pBribeSetting->m_value.m_type, Chunks::TypedValue::TYPE::FLOAT);
+    EXPECT_EQ(pBribeSetting->m_value.m_float, 0.5f);
+
+    const CONT* pChest = pCollection->GetContainerById(0x01000D62);
+    ASSERT_NE(pChest, nullptr);
+    EXPECT_EQ(pChest->m_editorId, "PersonalChest");
+    EXPECT_EQ(pChest->m_name, "Chest");
+    ASSERT_EQ(pChest->m_objects.size(), 2);
+    EXPECT_EQ(pChest->m_objects[1].m_formId, 0x01000010);
+    EXPECT_EQ(pChest->m_objects[1].m_count, 1);
+
+    const WRLD* pWorld = pCollection->GetWorldById(0x3C);
+    ASSERT_NE(pWorld, nullptr);
+    EXPECT_EQ(pWorld->m_editorId, "Tamriel");
+    ASSERT_TRUE(pWorld->m_centerCell);
+    EXPECT_EQ(pWorld->m_centerCell->m_x, -3);
+    EXPECT_EQ(pWorld->m_centerCell->m_y, 7);
+    EXPECT_EQ(pWorld->m_climateId, 0x01000D62);
+    EXPECT_FALSE(pWorld->m_parentId);
+    EXPECT_EQ(pWorld->m_lodMultiplier, 1.5f);
+    ASSERT_EQ(pWorld->m_navMeshRefs.size(), 1);
+
+    const NAVM* pNavMesh = pWorld->m_navMeshRefs[0];
+    EXPECT_EQ(pNavMesh->GetFormId(), 0x01000100);
+    EXPECT_EQ(pNavMesh->m_navMesh.m_vertices.size(), 4);
+    EXPECT_EQ(pNavMesh->m_navMesh.m_triangles.size(), 2);
+    ASSERT_EQ(pNavMesh->m_navMesh.m_connections.size(), 1);
+    EXPECT_EQ(pNavMesh->m_navMesh.m_connections[0].m_navMeshId, 0x01000200);
+
+    const auto* pNpc = FindNpc(*pCollection, kNpcId);
+    ASSERT_NE(pNpc, nullptr);
+    EXPECT_EQ(pNpc->Plugin, 0);
+    EXPECT_EQ(pNpc->Offset, 128);
+    EXPECT_FALSE(pNpc->pRecord);
+}
+
+TEST_F(RecordCacheTest, KeyMismatch)
+{
+    ASSERT_TRUE(RecordCache::Save(m_cachePath, m_loadOrder, *MakeCollection()));
+
+    auto loadOrder = m_loadOrder;
+    loadOrder[0].Hash ^= 1;
+    EXPECT_FALSE(RecordCache::Load(m_cachePath, loadOrder, m_dataFiles));
+
+    loadOrder = m_loadOrder;
+    loadOrder.push_back(m_loadOrder[0]);
+    loadOrder[1].Name = "Other.esp";
+    EXPECT_FALSE(RecordCache::Load(m_cachePath, loadOrder, m_dataFiles));
+
+    EXPECT_TRUE(RecordCache::Load(m_cachePath, m_loadOrder, m_dataFiles));
+}
+
+TEST_F(RecordCacheTest, TruncatedFile)
+{
+    ASSERT_TRUE(RecordCache::Save(m_cachePath, m_loadOrder, *MakeCollection()));
+
+    const auto cBytes = ReadCache();
+    ASSERT_FALSE(cBytes.empty());
+
+    // Every rejected cache is logged
+    const auto cLevel = spdlog::get_level();
+    spdlog::set_level(spdlog::level::off);
+
+    for (size_t size = 0; size < cBytes.size(); ++size)
+    {
+        WriteCache(cBytes, size);
+        EXPECT_FALSE(RecordCache::Load(m_cachePath, m_loadOrder, m_dataFiles)) << "Truncated to " << size << " bytes";
+    }
+
+    spdlog::set_level(cLevel);
+}
+
+TEST_F(RecordCacheTest, TrailingBytes)
+{
+    ASSERT_TRUE(RecordCache::Save(m_cachePath, m_loadOrder, *MakeCollection()));
+
+    auto bytes = ReadCache();
+    bytes.push_back(0);
+    WriteCache(bytes, bytes.size());
+
+    EXPECT_FALSE(RecordCache::Load(m_cachePath, m_loadOrder, m_dataFiles));
+}
+
+// Reads a hand written loadorder.txt, no game data is needed
+class LoadOrderTest : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        m_directory = std::filesystem::temp_directory_path() / "ESLoaderLoadOrderTest";
+        std::filesystem::create_directories(m_directory);
+    }
+
+    void TearDown() override
+    {
+        std::error_code error;
+        std::filesystem::remove_all(m_directory, error);
+    }
+
+    PluginCollection Load(const char* acpContent)
+    {
+        {
+            std::ofstream file(m_directory / "loadorder.txt", std::ios::binary | std::ios::trunc);
+            file << acpContent;
+        }
+
+        ESLoader loader;
+        loader.m_directory = m_directory;
+        EXPECT_TRUE(loader.LoadLoadOrder());
+
+        return loader.GetLoadOrder();
+    }
+
+protected:
+    std::filesystem::path m_directory;
+};
+
+TEST_F(LoadOrderTest, CrlfBlankLinesAreSkipped)
+{
+    const auto cLoadOrder = Load("# Comment\r\n\r\nSkyrim.esm\r\n\r\nUpdate.esm\r\nMod.esl\r\n\r\nMod.esp\r\n");
+
+    ASSERT_EQ(cLoadOrder.size(), 4);
+
+    EXPECT_EQ(cLoadOrder[0].m_filename, "Skyrim.esm");
+    EXPECT_FALSE(cLoadOrder[0].IsLite());
+    EXPECT_EQ(cLoadOrder[0].m_standardId, 0);
+
+    EXPECT_EQ(cLoadOrder[1].m_filename, "Update.esm");
+    EXPECT_EQ(cLoadOrder[1].m_standardId, 1);
+
+    EXPECT_EQ(cLoadOrder[2].m_filename, "Mod.esl");
+    EXPECT_TRUE(cLoadOrder[2].IsLite());
+    EXPECT_EQ(cLoadOrder[2].m_liteId, 0);
+
+    EXPECT_EQ(cLoadOrder[3].m_filename, "Mod.esp");
+    EXPECT_EQ(cLoadOrder[3].m_standardId, 2);
+}
+} // namespace ESLoader
@@ -0,0 +1,124 @@
+#include "MappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace ESLoader
+{
+MappedFile::~MappedFile() noexcept
+{
+    Close();
+}
+
+MappedFile::MappedFile(MappedFile&& aRhs) noexcept
+{
+    *this = std::move(aRhs);
+}
+
+MappedFile& MappedFile::operator=(MappedFile&& aRhs) noexcept
+{
+    if (this == &aRhs)
+        return *this;
+
+    Close();
+
+    std::swap(m_pData, aRhs.m_pData);
+    std::swap(m_size, aRhs.m_size);
+#ifdef _WIN32
+    std::swap(m_pFile, aRhs.m_pFile);
+    std::swap(m_pMapping, aRhs.m_pMapping);
+#endif
+
+    return *this;
+}
+
+bool MappedFile::Open(const std::filesystem::path& acPath) noexcept
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileW(acPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return false;
+
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        CloseHandle(file);
+        return false;
+    }
+
+    const void* pData = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!pData)
+    {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_pFile = file;
+    m_pMapping = mapping;
+    m_pData = static_cast<const uint8_t*>(pData);
+    m_size = static_cast<size_t>(size.QuadPart);
+#else
+    const int file = open(acPath.c_str(), O_RDONLY);
+    if (file < 0)
+        return false;
+
+    struct stat status{};
+    if (fstat(file, &status) != 0 || status.st_size == 0)
+    {
+        close(file);
+        return false;
+    }
+
+    void* pData = mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+    // The mapping keeps its own reference to the file
+    close(file);
+
+    if (pData == MAP_FAILED)
+        return false;
+
+    // Records are parsed front to back
+    madvise(pData, static_cast<size_t>(status.st_size), MADV_SEQUENTIAL);
+
+    m_pData = static_cast<const uint8_t*>(pData);
+    m_size = static_cast<size_t>(status.st_size);
+#endif
+
+    return true;
+}
+
+void MappedFile::Close() noexcept
+{
+    if (!m_pData)
+        return;
+
+#ifdef _WIN32
+    UnmapViewOfFile(m_pData);
+    CloseHandle(m_pMapping);
+    CloseHandle(m_pFile);
+    m_pFile = m_pMapping = nullptr;
+#else
+    munmap(const_cast<uint8_t*>(m_pData), m_size);
+#endif
+
+    m_pData = nullptr;
+    m_size = 0;
+}
+} // namespace ESLoader
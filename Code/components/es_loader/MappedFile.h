@@ -0,0 +1,36 @@
+#pragma once
+
+namespace ESLoader
+{
+/**
+ * @brief Read only memory mapping of a whole file.
+ *
+ * Plugins are hundreds of megabytes, mapping them lets the OS page in what is parsed instead of copying the file.
+ */
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile() noexcept;
+
+    MappedFile(MappedFile&& aRhs) noexcept;
+    MappedFile& operator=(MappedFile&& aRhs) noexcept;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool Open(const std::filesystem::path& acPath) noexcept;
+    void Close() noexcept;
+
+    [[nodiscard]] bool IsOpen() const noexcept { return m_pData != nullptr; }
+    [[nodiscard]] const uint8_t* GetData() const noexcept { return m_pData; }
+    [[nodiscard]] size_t GetSize() const noexcept { return m_size; }
+
+private:
+    const uint8_t* m_pData = nullptr;
+    size_t m_size = 0;
+#ifdef _WIN32
+    void* m_pFile = nullptr;
+    void* m_pMapping = nullptr;
+#endif
+};
+} // namespace ESLoader
@@ -0,0 +1,408 @@
+#include "NavMeshQuery.h"
+
+#include "Records/NAVM.h"
+
+#include <algorithm>
+#include <numeric>
+
+namespace ESLoader
+{
+namespace
+{
+constexpr uint32_t kMaxLeafTriangles = 4;
+// Deeper than any hierarchy of a median split over 32 bit triangle indices
+constexpr size_t kMaxStackSize = 64;
+// Triangle flags, set when the edge links to a triangle of another navmesh
+constexpr uint16_t kEdgeLinkFlags[3] = {0x1, 0x2, 0x4};
+
+float DistanceSquaredToBox(const glm::vec3& acPoint, const glm::vec3& acMin, const glm::vec3& acMax) noexcept
+{
+    const glm::vec3 cDelta = glm::max(glm::max(acMin - acPoint, acPoint - acMax), glm::vec3(0.f));
+    return glm::dot(cDelta, cDelta);
+}
+
+// Real-Time Collision Detection, 5.1.5
+glm::vec3 ClosestPointOnTriangle(const glm::vec3& acPoint, const glm::vec3& acA, const glm::vec3& acB, const glm::vec3& acC) noexcept
+{
+    const glm::vec3 cAB = acB - acA;
+    const glm::vec3 cAC = acC - acA;
+    const glm::vec3 cAP = acPoint - acA;
+
+    const float cD1 = glm::dot(cAB, cAP);
+    const float cD2 = glm::dot(cAC, cAP);
+    if (cD1 <= 0.f && cD2 <= 0.f)
+        return acA;
+
+    const glm::vec3 cBP = acPoint - acB;
+    const float cD3 = glm::dot(cAB, cBP);
+    const float cD4 = glm::dot(cAC, cBP);
+    if (cD3 >= 0.f && cD4 <= cD3)
+        return acB;
+
+    const float cVC = cD1 * cD4 - cD3 * cD2;
+    if (cVC <= 0.f && cD1 >= 0.f && cD3 <= 0.f)
+        return acA + cAB * (cD1 / (cD1 - cD3));
+
+    const glm::vec3 cCP = acPoint - acC;
+    const float cD5 = glm::dot(cAB, cCP);
+    const float cD6 = glm::dot(cAC, cCP);
+    if (cD6 >= 0.f && cD5 <= cD6)
+        return acC;
+
+    const float cVB = cD5 * cD2 - cD1 * cD6;
+    if (cVB <= 0.f && cD2 >= 0.f && cD6 <= 0.f)
+        return acA + cAC * (cD2 / (cD2 - cD6));
+
+    const float cVA = cD3 * cD6 - cD5 * cD4;
+    if (cVA <= 0.f && (cD4 - cD3) >= 0.f && (cD5 - cD6) >= 0.f)
+        return acB + (acC - acB) * ((cD4 - cD3) / ((cD4 - cD3) + (cD5 - cD6)));
+
+    const float cDenominator = 1.f / (cVA + cVB + cVC);
+    return acA + cAB * (cVB * cDenominator) + cAC * (cVC * cDenominator);
+}
+
+uint32_t FindRoot(Vector<uint32_t>& aParents, uint32_t aTriangle) noexcept
+{
+    while (aParents[aTriangle] != aTriangle)
+    {
+        aParents[aTriangle] = aParents[aParents[aTriangle]];
+        aTriangle = aParents[aTriangle];
+    }
+
+    return aTriangle;
+}
+
+void Join(Vector<uint32_t>& aParents, uint32_t aLhs, uint32_t aRhs) noexcept
+{
+    const auto cLhsRoot = FindRoot(aParents, aLhs);
+    const auto cRhsRoot = FindRoot(aParents, aRhs);
+    if (cLhsRoot != cRhsRoot)
+        aParents[std::max(cLhsRoot, cRhsRoot)] = std::min(cLhsRoot, cRhsRoot);
+}
+} // namespace
+
+NavMeshQuery::NavMeshQuery(const Vector<NAVM const*>& acNavMeshes) noexcept
+{
+    // Navmeshes referencing vertices they do not have are skipped, their triangles could not be placed
+    Vector<NAVM const*> navMeshes;
+    Vector<uint32_t> triangleBases;
+
+    size_t vertexCount = 0;
+    size_t triangleCount = 0;
+    for (const auto* pNavMesh : acNavMeshes)
+    {
+        const auto& cMesh = pNavMesh->m_navMesh;
+
+        const bool cValid = std::all_of(std::begin(cMesh.m_triangles), std::end(cMesh.m_triangles), [&cMesh](const auto& acTriangle) {
+            const auto cCount = static_cast<int32_t>(cMesh.m_vertices.size());
+            return acTriangle.m_vertex0 >= 0 && acTriangle.m_vertex0 < cCount && acTriangle.m_vertex1 >= 0 && acTriangle.m_vertex1 < cCount &&
+                   acTriangle.m_vertex2 >= 0 && acTriangle.m_vertex2 < cCount;
+        });
+
+        if (!cValid)
+        {
+            spdlog::warn("Navmesh {:X} references missing vertices, it is ignored", pNavMesh->GetFormId());
+            continue;
+        }
+
+        navMeshes.push_back(pNavMesh);
+        triangleBases.push_back(static_cast<uint32_t>(triangleCount));
+
+        vertexCount += cMesh.m_vertices.size();
+        triangleCount += cMesh.m_triangles.size();
+    }
+
+    m_vertices.reserve(vertexCount);
+    m_triangles.reserve(triangleCount);
+
+    for (const auto* pNavMesh : navMeshes)
+    {
+        const auto& cMesh = pNavMesh->m_navMesh;
+        const auto cVertexBase = static_cast<uint32_t>(m_vertices.size());
+
+        m_vertices.insert(std::end(m_vertices), std::begin(cMesh.m_vertices), std::end(cMesh.m_vertices));
+
+        for (const auto& cTriangle : cMesh.m_triangles)
+        {
+            m_triangles.push_back({{cVertexBase + cTriangle.m_vertex0, cVertexBase + cTriangle.m_vertex1, cVertexBase + cTriangle.m_vertex2}, 0});
+        }
+    }
+
+    BuildIslands(navMeshes, triangleBases);
+    BuildHierarchy();
+}
+
+std::optional<NavMeshQuery::Hit> NavMeshQuery::FindNearest(const glm::vec3& acPosition, float aMaxDistance) const noexcept
+{
+    if (m_nodes.empty())
+        return std::nullopt;
+
+    Hit hit;
+    float bestDistanceSquared = aMaxDistance * aMaxDistance;
+
+    uint32_t stack[kMaxStackSize];
+    size_t stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        const auto& cNode = m_nodes[stack[--stackSize]];
+        if (DistanceSquaredToBox(acPosition, cNode.Min, cNode.Max) > bestDistanceSquared)
+            continue;
+
+        if (cNode.Count > 0)
+        {
+            for (uint32_t i = cNode.First; i < cNode.First + cNode.Count; ++i)
+            {
+                const auto& cTriangle = m_triangles[i];
+                const auto cPoint = ClosestPointOnTriangle(acPosition, m_vertices[cTriangle.Vertices[0]], m_vertices[cTriangle.Vertices[1]],
+                                                           m_vertices[cTriangle.Vertices[2]]);
+
+                const glm::vec3 cDelta = cPoint - acPosition;
+                const float cDistanceSquared = glm::dot(cDelta, cDelta);
+                if (cDistanceSquared <= bestDistanceSquared)
+                {
+                    bestDistanceSquared = cDistanceSquared;
+                    hit.Triangle = i;
+                    hit.Position = cPoint;
+                }
+            }
+
+            continue;
+        }
+
+        // The closer child is pushed last so it is visited first and tightens the bound for the other one
+        const auto& cLeft = m_nodes[cNode.First];
+        const auto& cRight = m_nodes[cNode.First + 1];
+        const float cLeftDistance = DistanceSquaredToBox(acPosition, cLeft.Min, cLeft.Max);
+        const float cRightDistance = DistanceSquaredToBox(acPosition, cRight.Min, cRight.Max);
+
+        const bool cLeftFirst = cLeftDistance <= cRightDistance;
+        const uint32_t cNear = cLeftFirst ? cNode.First : cNode.First + 1;
+        const uint32_t cFar = cLeftFirst ? cNode.First + 1 : cNode.First;
+        const float cNearDistance = cLeftFirst ? cLeftDistance : cRightDistance;
+        const float cFarDistance = cLeftFirst ? cRightDistance : cLeftDistance;
+
+        if (cFarDistance <= bestDistanceSquared)
+            stack[stackSize++] = cFar;
+        if (cNearDistance <= bestDistanceSquared)
+            stack[stackSize++] = cNear;
+    }
+
+    if (hit.Triangle == kInvalidTriangle)
+        return std::nullopt;
+
+    hit.Distance = std::sqrt(bestDistanceSquared);
+    return hit;
+}
+
+std::optional<float> NavMeshQuery::GetGroundHeight(float aX, float aY, float aMaxZ) const noexcept
+{
+    if (m_nodes.empty())
+        return std::nullopt;
+
+    std::optional<float> height;
+
+    uint32_t stack[kMaxStackSize];
+    size_t stackSize = 0;
+    stack[stackSize++] = 0;
+
+    while (stackSize > 0)
+    {
+        const auto& cNode = m_nodes[stack[--stackSize]];
+        if (aX < cNode.Min.x || aX > cNode.Max.x || aY < cNode.Min.y || aY > cNode.Max.y || cNode.Min.z > aMaxZ)
+            continue;
+
+        // Nothing below can beat what was already found
+        if (height && cNode.Max.z <= *height)
+            continue;
+
+        if (cNode.Count == 0)
+        {
+            stack[stackSize++] = cNode.First;
+            stack[stackSize++] = cNode.First + 1;
+            continue;
+        }
+
+        for (uint32_t i = cNode.First; i < cNode.First + cNode.Count; ++i)
+        {
+            const auto& cTriangle = m_triangles[i];
+            const auto& cA = m_vertices[cTriangle.Vertices[0]];
+            const auto& cB = m_vertices[cTriangle.Vertices[1]];
+            const auto& cC = m_vertices[cTriangle.Vertices[2]];
+
+            // Barycentric coordinates in the ground plane, walls have no area there and are skipped
+            const float cDenominator = (cB.y - cC.y) * (cA.x - cC.x) + (cC.x - cB.x) * (cA.y - cC.y);
+            if (std::abs(cDenominator) < 1e-6f)
+                continue;
+
+            const float cU = ((cB.y - cC.y) * (aX - cC.x) + (cC.x - cB.x) * (aY - cC.y)) / cDenominator;
+            const float cV = ((cC.y - cA.y) * (aX - cC.x) + (cA.x - cC.x) * (aY - cC.y)) / cDenominator;
+            const float cW = 1.f - cU - cV;
+
+            constexpr float kEpsilon = -1e-4f;
+            if (cU < kEpsilon || cV < kEpsilon || cW < kEpsilon)
+                continue;
+
+            const float cZ = cU * cA.z + cV * cB.z + cW * cC.z;
+            if (cZ <= aMaxZ && (!height || cZ > *height))
+                height = cZ;
+        }
+    }
+
+    return height;
+}
+
+bool NavMeshQuery::IsReachable(uint32_t aFromTriangle, uint32_t aToTriangle) const noexcept
+{
+    if (aFromTriangle >= m_triangles.size() || aToTriangle >= m_triangles.size())
+        return false;
+
+    return m_triangles[aFromTriangle].Island == m_triangles[aToTriangle].Island;
+}
+
+size_t NavMeshQuery::GetMemoryUsage() const noexcept
+{
+    return m_vertices.capacity() * sizeof(glm::vec3) + m_triangles.capacity() * sizeof(Triangle) + m_nodes.capacity() * sizeof(Node);
+}
+
+void NavMeshQuery::BuildIslands(const Vector<NAVM const*>& acNavMeshes, const Vector<uint32_t>& acTriangleBases) noexcept
+{
+    Map<uint32_t, uint32_t> navMeshIndices;
+    navMeshIndices.reserve(acNavMeshes.size());
+    for (uint32_t i = 0; i < acNavMeshes.size(); ++i)
+        navMeshIndices[acNavMeshes[i]->GetFormId()] = i;
+
+    Vector<uint32_t> parents(m_triangles.size());
+    std::iota(std::begin(parents), std::end(parents), 0);
+
+    for (uint32_t i = 0; i < acNavMeshes.size(); ++i)
+    {
+        const auto& cMesh = acNavMeshes[i]->m_navMesh;
+        const auto cBase = acTriangleBases[i];
+        const auto cTriangleCount = static_cast<int32_t>(cMesh.m_triangles.size());
+
+        for (int32_t triangle = 0; triangle < cTriangleCount; ++triangle)
+        {
+            const auto& cTriangle = cMesh.m_triangles[triangle];
+            const int16_t cEdges[3] = {cTriangle.m_edge0, cTriangle.m_edge1, cTriangle.m_edge2};
+
+            for (size_t edge = 0; edge < 3; ++edge)
+            {
+                const auto cLink = cEdges[edge];
+                if (cLink < 0)
+                    continue;
+
+                // The flags are what the parser calls the cover marker
+                if ((cTriangle.m_coverMarker & kEdgeLinkFlags[edge]) == 0)
+                {
+                    if (cLink < cTriangleCount)
+                        Join(parents, cBase + triangle, cBase + cLink);
+
+                    continue;
+                }
+
+                if (cLink >= static_cast<int32_t>(cMesh.m_connections.size()))
+                    continue;
+
+                // Links to navmeshes of other world spaces, or that were ignored, are not followed
+                const auto& cConnection = cMesh.m_connections[cLink];
+                const auto cTarget = navMeshIndices.find(cConnection.m_navMeshId);
+                if (cTarget == std::end(navMeshIndices) || cConnection.tri < 0 ||
+                    cConnection.tri >= static_cast<int32_t>(acNavMeshes[cTarget->second]->m_navMesh.m_triangles.size()))
+                    continue;
+
+                Join(parents, cBase + triangle, acTriangleBases[cTarget->second] + cConnection.tri);
+            }
+        }
+    }
+
+    // Islands are numbered from 0, roots always come before the triangles joined to them
+    Vector<uint32_t> islands(m_triangles.size());
+    m_islandCount = 0;
+    for (uint32_t i = 0; i < m_triangles.size(); ++i)
+    {
+        const auto cRoot = FindRoot(parents, i);
+        islands[i] = cRoot == i ? m_islandCount++ : islands[cRoot];
+        m_triangles[i].Island = islands[i];
+    }
+}
+
+void NavMeshQuery::BuildHierarchy() noexcept
+{
+    if (m_triangles.empty())
+        return;
+
+    Vector<glm::vec3> centroids(m_triangles.size());
+    for (size_t i = 0; i < m_triangles.size(); ++i)
+    {
+        const auto& cTriangle = m_triangles[i];
+        centroids[i] = (m_vertices[cTriangle.Vertices[0]] + m_vertices[cTriangle.Vertices[1]] + m_vertices[cTriangle.Vertices[2]]) / 3.f;
+    }
+
+    Vector<uint32_t> order(m_triangles.size());
+    std::iota(std::begin(order), std::end(order), 0);
+
+    // Median splits leave at least two triangles per leaf, there are never more nodes than triangles
+    m_nodes.reserve(m_triangles.size());
+    m_nodes.emplace_back();
+    BuildNode(0, order, centroids, 0, static_cast<uint32_t>(order.size()));
+    m_nodes.shrink_to_fit();
+
+    // Leaves reference contiguous ranges of the reordered triangles
+    Vector<Triangle> triangles;
+    triangles.reserve(m_triangles.size());
+    for (const auto cIndex : order)
+        triangles.push_back(m_triangles[cIndex]);
+
+    m_triangles = std::move(triangles);
+}
+
+void NavMeshQuery::BuildNode(uint32_t aNode, Vector<uint32_t>& aOrder, const Vector<glm::vec3>& acCentroids, uint32_t aBegin, uint32_t aEnd) noexcept
+{
+    glm::vec3 min(std::numeric_limits<float>::max());
+    glm::vec3 max(std::numeric_limits<float>::lowest());
+    glm::vec3 centroidMin = min;
+    glm::vec3 centroidMax = max;
+
+    for (uint32_t i = aBegin; i < aEnd; ++i)
+    {
+        for (const auto cVertex : m_triangles[aOrder[i]].Vertices)
+        {
+            min = glm::min(min, m_vertices[cVertex]);
+            max = glm::max(max, m_vertices[cVertex]);
+        }
+
+        centroidMin = glm::min(centroidMin, acCentroids[aOrder[i]]);
+        centroidMax = glm::max(centroidMax, acCentroids[aOrder[i]]);
+    }
+
+    m_nodes[aNode].Min = min;
+    m_nodes[aNode].Max = max;
+
+    if (aEnd - aBegin <= kMaxLeafTriangles)
+    {
+        m_nodes[aNode].First = aBegin;
+        m_nodes[aNode].Count = aEnd - aBegin;
+        return;
+    }
+
+    // Median split on the longest axis of the centroids keeps the tree balanced
+    const glm::vec3 cExtent = centroidMax - centroidMin;
+    const int cAxis = cExtent.x >= cExtent.y && cExtent.x >= cExtent.z ? 0 : (cExtent.y >= cExtent.z ? 1 : 2);
+    const uint32_t cMiddle = aBegin + (aEnd - aBegin) / 2;
+
+    std::nth_element(std::begin(aOrder) + aBegin, std::begin(aOrder) + cMiddle, std::begin(aOrder) + aEnd,
+                     [&acCentroids, cAxis](uint32_t aLhs, uint32_t aRhs) { return acCentroids[aLhs][cAxis] < acCentroids[aRhs][cAxis]; });
+
+    // Children are allocated together, the node only stores the first one
+    const auto cChildren = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.resize(m_nodes.size() + 2);
+
+    m_nodes[aNode].First = cChildren;
+    m_nodes[aNode].Count = 0;
+
+    BuildNode(cChildren, aOrder, acCentroids, aBegin, cMiddle);
+    BuildNode(cChildren + 1, aOrder, acCentroids, cMiddle, aEnd);
+}
+} // namespace ESLoader
@@ -0,0 +1,74 @@
+#pragma once
+
+class NAVM;
+
+namespace ESLoader
+{
+/**
+ * @brief Spatial queries over the navmeshes of one world space.
+ *
+ * Triangles of every navmesh are flattened into one array and indexed by a bounding volume hierarchy, so a
+ * query only tests the few triangles near the position. Triangles linked by their edges, within a navmesh or
+ * across navmeshes through NVNM edge links, form islands: two triangles are reachable from one another on foot
+ * when they are in the same island. Doors are not followed.
+ *
+ * Immutable once built, queries can run on any number of threads.
+ */
+class NavMeshQuery
+{
+public:
+    static constexpr uint32_t kInvalidTriangle = std::numeric_limits<uint32_t>::max();
+
+    struct Hit
+    {
+        uint32_t Triangle = kInvalidTriangle;
+        // Closest point of the triangle
+        glm::vec3 Position{};
+        float Distance = 0.f;
+    };
+
+    NavMeshQuery() = default;
+    explicit NavMeshQuery(const Vector<NAVM const*>& acNavMeshes) noexcept;
+
+    /**
+     * @brief Finds the closest point on the navmesh within aMaxDistance of acPosition.
+     */
+    [[nodiscard]] std::optional<Hit> FindNearest(const glm::vec3& acPosition, float aMaxDistance) const noexcept;
+    /**
+     * @brief Returns the height of the highest surface under (aX, aY) that is not above aMaxZ.
+     */
+    [[nodiscard]] std::optional<float> GetGroundHeight(float aX, float aY, float aMaxZ) const noexcept;
+    [[nodiscard]] bool IsReachable(uint32_t aFromTriangle, uint32_t aToTriangle) const noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept { return m_triangles.empty(); }
+    [[nodiscard]] size_t GetTriangleCount() const noexcept { return m_triangles.size(); }
+    [[nodiscard]] size_t GetNodeCount() const noexcept { return m_nodes.size(); }
+    [[nodiscard]] uint32_t GetIslandCount() const noexcept { return m_islandCount; }
+    [[nodiscard]] size_t GetMemoryUsage() const noexcept;
+
+private:
+    struct Triangle
+    {
+        uint32_t Vertices[3];
+        uint32_t Island;
+    };
+
+    // Leaves hold Count triangles from First, inner nodes have their children at First and First + 1
+    struct Node
+    {
+        glm::vec3 Min;
+        uint32_t First;
+        glm::vec3 Max;
+        uint32_t Count;
+    };
+
+    void BuildIslands(const Vector<NAVM const*>& acNavMeshes, const Vector<uint32_t>& acTriangleBases) noexcept;
+    void BuildHierarchy() noexcept;
+    void BuildNode(uint32_t aNode, Vector<uint32_t>& aOrder, const Vector<glm::vec3>& acCentroids, uint32_t aBegin, uint32_t aEnd) noexcept;
+
+    Vector<glm::vec3> m_vertices;
+    Vector<Triangle> m_triangles;
+    Vector<Node> m_nodes;
+    uint32_t m_islandCount = 0;
+};
+} // namespace ESLoader
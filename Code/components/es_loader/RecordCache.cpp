@@ -0,0 +1,571 @@
+#include "RecordCache.h"
+#include "MappedFile.h"
+
+#include <cstring>
+#include <fstream>
+
+namespace ESLoader
+{
+namespace
+{
+constexpr uint32_t kMagic = 0x43525054; // TPRC
+// The TES4 header with its master list fits in the first bytes of a plugin
+constexpr size_t kHashedBytes = 64 * 1024;
+
+struct CacheWriter
+{
+    template <class T> void Write(const T& acValue) noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        const auto* pBytes = reinterpret_cast<const uint8_t*>(&acValue);
+        Data.insert(std::end(Data), pBytes, pBytes + sizeof(T));
+    }
+
+    void WriteBytes(const void* apData, size_t aSize) noexcept
+    {
+        const auto* pBytes = static_cast<const uint8_t*>(apData);
+        Data.insert(std::end(Data), pBytes, pBytes + aSize);
+    }
+
+    void WriteString(const String& acValue) noexcept
+    {
+        Write(static_cast<uint32_t>(acValue.size()));
+        WriteBytes(acValue.data(), acValue.size());
+    }
+
+    template <class T> void WriteOptional(const std::optional<T>& acValue) noexcept
+    {
+        Write(static_cast<uint8_t>(acValue.has_value()));
+        if (acValue)
+            Write(*acValue);
+    }
+
+    void WriteHeader(const Record& acRecord) noexcept { WriteBytes(&acRecord, sizeof(Record)); }
+
+    Vector<uint8_t> Data;
+};
+
+// Reads past the end flag the reader as failed and return zeroes, the whole cache is then discarded
+struct CacheReader
+{
+    template <class T> T Read() noexcept
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        T value{};
+        ReadBytes(&value, sizeof(T));
+        return value;
+    }
+
+    void ReadBytes(void* apData, size_t aSize) noexcept
+    {
+        if (Failed || Size - Position < aSize)
+        {
+            Failed = true;
+            return;
+        }
+
+        std::memcpy(apData, pData + Position, aSize);
+        Position += aSize;
+    }
+
+    // Rejects counts that cannot fit in what is left, a corrupted count would otherwise allocate gigabytes
+    uint32_t ReadCount(size_t aMinElementSize) noexcept
+    {
+        const auto cCount = Read<uint32_t>();
+        if (Failed || cCount * static_cast<uint64_t>(aMinElementSize) > Size - Position)
+        {
+            Failed = true;
+            return 0;
+        }
+
+        return cCount;
+    }
+
+    String ReadString() noexcept
+    {
+        const auto cSize = ReadCount(1);
+        if (Failed)
+            return {};
+
+        String value(reinterpret_cast<const char*>(pData + Position), cSize);
+        Position += cSize;
+        return value;
+    }
+
+    template <class T> void ReadOptional(std::optional<T>& aValue) noexcept
+    {
+        if (Read<uint8_t>())
+            aValue = Read<T>();
+        else
+            aValue.reset();
+    }
+
+    void ReadHeader(Record& aRecord) noexcept
+    {
+        Record header;
+        ReadBytes(&header, sizeof(Record));
+        aRecord.CopyRecordData(header);
+    }
+
+    const uint8_t* pData;
+    size_t Size;
+    size_t Position = 0;
+    bool Failed = false;
+};
+
+void WriteRecord(CacheWriter& aWriter, const CLMT& acRecord) noexcept
+{
+    aWriter.WriteHeader(acRecord);
+    aWriter.WriteString(acRecord.m_editorId);
+    aWriter.Write(acRecord.m_weatherList.m_weatherId);
+    aWriter.Write(acRecord.m_weatherList.m_chance);
+    aWriter.Write(acRecord.m_weatherList.m_globalId);
+    aWriter.WriteString(acRecord.m_sunTexture);
+    aWriter.WriteString(acRecord.m_glareTexture);
+    aWriter.Write(acRecord.m_timing);
+}
+
+void ReadRecord(CacheReader& aReader, CLMT& aRecord) noexcept
+{
+    aReader.ReadHeader(aRecord);
+    aRecord.m_editorId = aReader.ReadString();
+    aRecord.m_weatherList.m_weatherId = aReader.Read<uint32_t>();
+    aRecord.m_weatherList.m_chance = aReader.Read<uint32_t>();
+    aRecord.m_weatherList.m_globalId = aReader.Read<uint32_t>();
+    aRecord.m_sunTexture = aReader.ReadString();
+    aRecord.m_glareTexture = aReader.ReadString();
+    aRecord.m_timing = aReader.Read<Chunks::TNAM>();
+}
+
+void WriteRecord(CacheWriter& aWriter, const CONT& acRecord) noexcept
+{
+    aWriter.WriteHeader(acRecord);
+    aWriter.WriteString(acRecord.m_editorId);
+    aWriter.WriteString(acRecord.m_name);
+    aWriter.Write(static_cast<uint32_t>(acRecord.m_objects.size()));
+    for (const auto& object : acRecord.m_objects)
+    {
+        aWriter.Write(object.m_formId);
+        aWriter.Write(object.m_count);
+    }
+}
+
+void ReadRecord(CacheReader& aReader, CONT& aRecord) noexcept
+{
+    aReader.ReadHeader(aRecord);
+    aRecord.m_editorId = aReader.ReadString();
+    aRecord.m_name = aReader.ReadString();
+    aRecord.m_objects.resize(aReader.ReadCount(sizeof(uint32_t) * 2));
+    for (auto& object : aRecord.m_objects)
+    {
+        object.m_formId = aReader.Read<uint32_t>();
+        object.m_count = aReader.Read<uint32_t>();
+    }
+}
+
+void WriteRecord(CacheWriter& aWriter, const GMST& acRecord) noexcept
+{
+    aWriter.WriteHeader(acRecord);
+    aWriter.WriteString(acRecord.m_editorId);
+    aWriter.Write(acRecord.m_value.m_type);
+    aWriter.Write(acRecord.m_value.m_int);
+}
+
+void ReadRecord(CacheReader& aReader, GMST& aRecord) noexcept
+{
+    aReader.ReadHeader(aRecord);
+    aRecord.m_editorId = aReader.ReadString();
+    aRecord.m_value.m_type = aReader.Read<Chunks::TypedValue::TYPE>();
+    aRecord.m_value.m_int = aReader.Read<uint32_t>();
+}
+
+void WriteRecord(CacheWriter& aWriter, const WRLD& acRecord) noexcept
+{
+    aWriter.WriteHeader(acRecord);
+    aWriter.WriteString(acRecord.m_editorId);
+    aWriter.WriteOptional(acRecord.m_centerCell);
+    aWriter.WriteOptional(acRecord.m_climateId);
+    aWriter.WriteOptional(acRecord.m_landData);
+    aWriter.WriteOptional(acRecord.m_parentId);
+    aWriter.Write(acRecord.m_musicId);
+    aWriter.Write(acRecord.m_lodMultiplier);
+}
+
+void ReadRecord(CacheReader& aReader, WRLD& aRecord) noexcept
+{
+    aReader.ReadHeader(aRecord);
+    aRecord.m_editorId = aReader.ReadString();
+    aReader.ReadOptional(aRecord.m_centerCell);
+    aReader.ReadOptional(aRecord.m_climateId);
+    aReader.ReadOptional(aRecord.m_landData);
+    aReader.ReadOptional(aRecord.m_parentId);
+    aRecord.m_musicId = aReader.Read<uint32_t>();
+    aRecord.m_lodMultiplier = aReader.Read<float>();
+}
+
+template <class T> void WriteArray(CacheWriter& aWriter, const Vector<T>& acValues) noexcept
+{
+    aWriter.Write(static_cast<uint32_t>(acValues.size()));
+    aWriter.WriteBytes(acValues.data(), acValues.size() * sizeof(T));
+}
+
+template <class T> void ReadArray(CacheReader& aReader, Vector<T>& aValues) noexcept
+{
+    aValues.resize(aReader.ReadCount(sizeof(T)));
+    aReader.ReadBytes(aValues.data(), aValues.size() * sizeof(T));
+}
+
+void WriteRecord(CacheWriter& aWriter, const NAVM& acRecord) noexcept
+{
+    const auto& navMesh = acRecord.m_navMesh;
+
+    aWriter.WriteHeader(acRecord);
+    aWriter.Write(navMesh.m_unknown);
+    aWriter.Write(navMesh.m_locactionMarker);
+    aWriter.Write(navMesh.m_worldSpaceId);
+    aWriter.WriteOptional(navMesh.m_cellId);
+    aWriter.WriteOptional(navMesh.m_gridX);
+    aWriter.WriteOptional(navMesh.m_gridY);
+    WriteArray(aWriter, navMesh.m_vertices);
+    WriteArray(aWriter, navMesh.m_triangles);
+
+    // Written field by field, the structs have padding
+    aWriter.Write(static_cast<uint32_t>(navMesh.m_connections.size()));
+    for (const auto& connection : navMesh.m_connections)
+    {
+        aWriter.Write(connection.m_unk);
+        aWriter.Write(connection.m_navMeshId);
+        aWriter.Write(connection.tri);
+    }
+
+    aWriter.Write(static_cast<uint32_t>(navMesh.m_doorTris.size()));
+    for (const auto& door : navMesh.m_doorTris)
+    {
+        aWriter.Write(door.tri);
+        aWriter.Write(door.m_unk);
+        aWriter.Write(door.m_doorId);
+    }
+
+    WriteArray(aWriter, navMesh.m_coverTris);
+    aWriter.Write(navMesh.m_divisor);
+    aWriter.Write(navMesh.m_maxDistance);
+    aWriter.Write(navMesh.m_min);
+    aWriter.Write(navMesh.m_max);
+}
+
+void ReadRecord(CacheReader& aReader, NAVM& aRecord) noexcept
+{
+    auto& navMesh = aRecord.m_navMesh;
+
+    aReader.ReadHeader(aRecord);
+    navMesh.m_unknown = aReader.Read<uint32_t>();
+    navMesh.m_locactionMarker = aReader.Read<uint32_t>();
+    navMesh.m_worldSpaceId = aReader.Read<uint32_t>();
+    aReader.ReadOptional(navMesh.m_cellId);
+    aReader.ReadOptional(navMesh.m_gridX);
+    aReader.ReadOptional(navMesh.m_gridY);
+    ReadArray(aReader, navMesh.m_vertices);
+    ReadArray(aReader, navMesh.m_triangles);
+
+    navMesh.m_connections.resize(aReader.ReadCount(sizeof(uint32_t) * 2 + sizeof(int16_t)));
+    for (auto& connection : navMesh.m_connections)
+    {
+        connection.m_unk = aReader.Read<uint32_t>();
+        connection.m_navMeshId = aReader.Read<uint32_t>();
+        connection.tri = aReader.Read<int16_t>();
+    }
+
+    navMesh.m_doorTris.resize(aReader.ReadCount(sizeof(int16_t) + sizeof(uint32_t) * 2));
+    for (auto& door : navMesh.m_doorTris)
+    {
+        door.tri = aReader.Read<int16_t>();
+        door.m_unk = aReader.Read<uint32_t>();
+        door.m_doorId = aReader.Read<uint32_t>();
+    }
+
+    ReadArray(aReader, navMesh.m_coverTris);
+    navMesh.m_divisor = aReader.Read<uint32_t>();
+    navMesh.m_maxDistance = aReader.Read<glm::vec2>();
+    navMesh.m_min = aReader.Read<glm::vec3>();
+    navMesh.m_max = aReader.Read<glm::vec3>();
+}
+
+// Tables are written sealed, they are read back in form id order and sealing them again does not sort
+template <class T> void WriteTable(CacheWriter& aWriter, const RecordTable<T>& acTable) noexcept
+{
+    aWriter.Write(static_cast<uint32_t>(acTable.Size()));
+    for (size_t i = 0; i < acTable.Size(); ++i)
+    {
+        aWriter.Write(acTable.GetId(i));
+        WriteRecord(aWriter, acTable.GetRecord(i));
+    }
+}
+
+template <class T> bool ReadTable(CacheReader& aReader, RecordTable<T>& aTable) noexcept
+{
+    const auto cCount = aReader.ReadCount(sizeof(uint32_t) + sizeof(Record));
+    aTable.Reserve(cCount);
+
+    for (uint32_t i = 0; i < cCount && !aReader.Failed; ++i)
+    {
+        const auto cFormId = aReader.Read<uint32_t>();
+
+        T record;
+        ReadRecord(aReader, record);
+        aTable.Add(cFormId, std::move(record));
+    }
+
+    aTable.Seal();
+
+    return !aReader.Failed;
+}
+
+// Only the location is stored, the record is parsed from its plugin when it is first looked up
+template <class T> void WriteTable(CacheWriter& aWriter, const RecordTable<LazyRecord<T>>& acTable) noexcept
+{
+    aWriter.Write(static_cast<uint32_t>(acTable.Size()));
+    for (size_t i = 0; i < acTable.Size(); ++i)
+    {
+        const auto& entry = acTable.GetRecord(i);
+
+        aWriter.Write(acTable.GetId(i));
+        aWriter.Write(entry.Plugin);
+        aWriter.Write(entry.Offset);
+    }
+}
+
+template <class T> bool ReadTable(CacheReader& aReader, RecordTable<LazyRecord<T>>& aTable, uint32_t aPluginCount) noexcept
+{
+    const auto cCount = aReader.ReadCount(sizeof(uint32_t) * 3);
+    aTable.Reserve(cCount);
+
+    for (uint32_t i = 0; i < cCount && !aReader.Failed; ++i)
+    {
+        const auto cFormId = aReader.Read<uint32_t>();
+
+        LazyRecord<T> entry;
+        entry.Plugin = aReader.Read<uint32_t>();
+        entry.Offset = aReader.Read<uint32_t>();
+
+        if (entry.Plugin >= aPluginCount)
+            aReader.Failed = true;
+
+        aTable.Add(cFormId, std::move(entry));
+    }
+
+    aTable.Seal();
+
+    return !aReader.Failed;
+}
+
+void WriteFormTypes(CacheWriter& aWriter, const RecordTable<FormEnum>& acFormTypes) noexcept
+{
+    aWriter.Write(static_cast<uint32_t>(acFormTypes.Size()));
+    for (size_t i = 0; i < acFormTypes.Size(); ++i)
+    {
+        aWriter.Write(acFormTypes.GetId(i));
+        aWriter.Write(acFormTypes.GetRecord(i));
+    }
+}
+
+bool ReadFormTypes(CacheReader& aReader, RecordTable<FormEnum>& aFormTypes) noexcept
+{
+    const auto cCount = aReader.ReadCount(sizeof(uint32_t) + sizeof(FormEnum));
+    aFormTypes.Reserve(cCount);
+
+    for (uint32_t i = 0; i < cCount && !aReader.Failed; ++i)
+    {
+        const auto cFormId = aReader.Read<uint32_t>();
+        aFormTypes.Add(cFormId, aReader.Read<FormEnum>());
+    }
+
+    aFormTypes.Seal();
+
+    return !aReader.Failed;
+}
+
+void WritePlugins(CacheWriter& aWriter, const Vector<PluginFile>& acPlugins) noexcept
+{
+    aWriter.Write(static_cast<uint32_t>(acPlugins.size()));
+    for (const auto& plugin : acPlugins)
+    {
+        aWriter.WriteString(plugin.Name);
+        aWriter.Write(plugin.FormIdPrefix);
+        aWriter.Write(static_cast<uint32_t>(plugin.FormIdPrefixes.size()));
+        for (const auto& [parentId, prefix] : plugin.FormIdPrefixes)
+        {
+            aWriter.Write(parentId);
+            aWriter.Write(prefix);
+        }
+    }
+}
+
+// The plugins were matched against the cache key already, they only have to be mapped again
+bool ReadPlugins(CacheReader& aReader, Vector<PluginFile>& aPlugins, const Map<String, std::filesystem::path>& acDataFiles) noexcept
+{
+    aPlugins.resize(aReader.ReadCount(sizeof(uint32_t) * 3));
+    for (auto& plugin : aPlugins)
+    {
+        plugin.Name = aReader.ReadString();
+        plugin.FormIdPrefix = aReader.Read<uint32_t>();
+
+        const auto cPrefixCount = aReader.ReadCount(sizeof(uint8_t) + sizeof(uint32_t));
+        for (uint32_t i = 0; i < cPrefixCount; ++i)
+        {
+            const auto cParentId = aReader.Read<uint8_t>();
+            plugin.FormIdPrefixes[cParentId] = aReader.Read<uint32_t>();
+        }
+
+        if (aReader.Failed)
+            return false;
+
+        const auto pathItor = acDataFiles.find(plugin.Name);
+        if (pathItor == std::end(acDataFiles) || !plugin.File.Open(pathItor->second))
+            return false;
+    }
+
+    return !aReader.Failed;
+}
+
+void WriteKeys(CacheWriter& aWriter, const Vector<RecordCache::PluginKey>& acLoadOrder) noexcept
+{
+    aWriter.Write(static_cast<uint32_t>(acLoadOrder.size()));
+    for (const auto& key : acLoadOrder)
+    {
+        aWriter.WriteString(key.Name);
+        aWriter.Write(key.Size);
+        aWriter.Write(key.WriteTime);
+        aWriter.Write(key.Hash);
+    }
+}
+
+bool KeysMatch(CacheReader& aReader, const Vector<RecordCache::PluginKey>& acLoadOrder) noexcept
+{
+    if (aReader.Read<uint32_t>() != acLoadOrder.size())
+        return false;
+
+    for (const auto& expected : acLoadOrder)
+    {
+        RecordCache::PluginKey key;
+        key.Name = aReader.ReadString();
+        key.Size = aReader.Read<uint64_t>();
+        key.WriteTime = aReader.Read<int64_t>();
+        key.Hash = aReader.Read<uint64_t>();
+
+        if (aReader.Failed || key != expected)
+            return false;
+    }
+
+    return true;
+}
+} // namespace
+
+bool RecordCache::BuildKey(const String& acName, const std::filesystem::path& acPath, PluginKey& aKey) noexcept
+{
+    MappedFile file;
+    if (!file.Open(acPath))
+        return false;
+
+    std::error_code error;
+    const auto cWriteTime = std::filesystem::last_write_time(acPath, error);
+    if (error)
+        return false;
+
+    // FNV-1a
+    uint64_t hash = 0xCBF29CE484222325;
+    const auto cHashedBytes = std::min(file.GetSize(), kHashedBytes);
+    for (size_t i = 0; i < cHashedBytes; ++i)
+        hash = (hash ^ file.GetData()[i]) * 0x100000001B3;
+
+    aKey.Name = acName;
+    aKey.Size = file.GetSize();
+    aKey.WriteTime = cWriteTime.time_since_epoch().count();
+    aKey.Hash = hash;
+
+    return true;
+}
+
+UniquePtr<RecordCollection> RecordCache::Load(const std::filesystem::path& acPath, const Vector<PluginKey>& acLoadOrder,
+                                              const Map<String, std::filesystem::path>& acDataFiles) noexcept
+{
+    MappedFile file;
+    if (!file.Open(acPath))
+        return nullptr;
+
+    CacheReader reader{file.GetData(), file.GetSize()};
+    if (reader.Read<uint32_t>() != kMagic || reader.Read<uint32_t>() != kVersion)
+    {
+        spdlog::info("Record cache was written by another version, plugins will be parsed again");
+        return nullptr;
+    }
+
+    if (!KeysMatch(reader, acLoadOrder))
+    {
+        spdlog::info("Load order changed since the record cache was written, plugins will be parsed again");
+        return nullptr;
+    }
+
+    auto pCollection = MakeUnique<RecordCollection>();
+    auto& collection = *pCollection;
+
+    const bool cLoaded = ReadPlugins(reader, collection.m_plugins, acDataFiles) && ReadFormTypes(reader, collection.m_formTypes);
+
+    const auto cPluginCount = static_cast<uint32_t>(collection.m_plugins.size());
+    const bool cTablesLoaded = cLoaded && ReadTable(reader, collection.m_objectReferences, cPluginCount) &&
+                               ReadTable(reader, collection.m_climates) && ReadTable(reader, collection.m_npcs, cPluginCount) &&
+                               ReadTable(reader, collection.m_containers) && ReadTable(reader, collection.m_gameSettings) &&
+                               ReadTable(reader, collection.m_worlds) && ReadTable(reader, collection.m_navMeshes);
+
+    if (!cTablesLoaded || reader.Position != reader.Size)
+    {
+        spdlog::warn("Record cache {} is corrupted, plugins will be parsed again", acPath.string());
+        return nullptr;
+    }
+
+    return pCollection;
+}
+
+bool RecordCache::Save(const std::filesystem::path& acPath, const Vector<PluginKey>& acLoadOrder, const RecordCollection& acCollection) noexcept
+{
+    CacheWriter writer;
+    writer.Write(kMagic);
+    writer.Write(kVersion);
+    WriteKeys(writer, acLoadOrder);
+
+    WritePlugins(writer, acCollection.m_plugins);
+    WriteFormTypes(writer, acCollection.m_formTypes);
+    WriteTable(writer, acCollection.m_objectReferences);
+    WriteTable(writer, acCollection.m_climates);
+    WriteTable(writer, acCollection.m_npcs);
+    WriteTable(writer, acCollection.m_containers);
+    WriteTable(writer, acCollection.m_gameSettings);
+    WriteTable(writer, acCollection.m_worlds);
+    WriteTable(writer, acCollection.m_navMeshes);
+
+    // Written next to the cache then renamed, a crash while saving never leaves a truncated cache behind
+    auto temporaryPath = acPath;
+    temporaryPath += ".tmp";
+
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(writer.Data.data()), writer.Data.size());
+        if (file.fail())
+        {
+            spdlog::warn("Failed to write record cache {}", temporaryPath.string());
+            return false;
+        }
+    }
+
+    std::error_code error;
+    std::filesystem::rename(temporaryPath, acPath, error);
+    if (error)
+    {
+        spdlog::warn("Failed to replace record cache {}: {}", acPath.string(), error.message());
+        return false;
+    }
+
+    return true;
+}
+} // namespace ESLoader
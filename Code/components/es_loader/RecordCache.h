@@ -0,0 +1,45 @@
+#pragma once
+
+#include <RecordCollection.h>
+
+namespace ESLoader
+{
+/**
+ * @brief On disk copy of a built RecordCollection.
+ *
+ * The cache is only used when it was built from the same load order: every plugin must match by name, size,
+ * write time and a hash of its first bytes, which hold the TES4 header. Anything else, including a cache
+ * written by another version of the format, makes Load fail and the plugins are parsed again.
+ */
+class RecordCache
+{
+public:
+    // Bump whenever the layout of a cached record changes
+    static constexpr uint32_t kVersion = 3;
+
+    struct PluginKey
+    {
+        bool operator==(const PluginKey& acRhs) const noexcept = default;
+
+        String Name;
+        uint64_t Size;
+        int64_t WriteTime;
+        uint64_t Hash;
+    };
+
+    /**
+     * @brief Computes the key of a plugin file, returns false if the file cannot be read.
+     */
+    [[nodiscard]] static bool BuildKey(const String& acName, const std::filesystem::path& acPath, PluginKey& aKey) noexcept;
+
+    /**
+     * @brief Returns the cached collection if the cache matches the given load order, nullptr otherwise.
+     *
+     * Records parsed on demand are cached as their location, their plugins are mapped again from acDataFiles.
+     * References between records are not stored, BuildReferences must be called on the result.
+     */
+    [[nodiscard]] static UniquePtr<RecordCollection> Load(const std::filesystem::path& acPath, const Vector<PluginKey>& acLoadOrder,
+                                                          const Map<String, std::filesystem::path>& acDataFiles) noexcept;
+    static bool Save(const std::filesystem::path& acPath, const Vector<PluginKey>& acLoadOrder, const RecordCollection& acCollection) noexcept;
+};
+} // namespace ESLoader
@@ -1,16 +1,112 @@
 #include "RecordCollection.h"
+#include "TESFile.h"
 
 namespace ESLoader
 {
+namespace
+{
+template <class T> void MergeTable(RecordTable<LazyRecord<T>>& aTable, RecordTable<LazyRecord<T>>& aOverrides, uint32_t aPluginOffset) noexcept
+{
+    for (auto& entry : aOverrides)
+        entry.Plugin += aPluginOffset;
+
+    aTable.Append(std::move(aOverrides));
+}
+} // namespace
+
+template <class T> T* RecordCollection::Resolve(RecordTable<LazyRecord<T>>& aTable, uint32_t aFormId) noexcept
+{
+    auto* pEntry = aTable.Find(aFormId);
+    if (!pEntry)
+        return nullptr;
+
+    if (pEntry->pRecord)
+        return pEntry->pRecord.get();
+
+    pEntry->pRecord = MakeUnique<T>();
+
+    if (pEntry->Plugin < m_plugins.size())
+    {
+        auto& plugin = m_plugins[pEntry->Plugin];
+        auto* pRecord = reinterpret_cast<Record*>(const_cast<uint8_t*>(plugin.File.GetData()) + pEntry->Offset);
+
+        *pEntry->pRecord = TESFile::CopyAndParseRecord<T>(pRecord, plugin.FormIdPrefixes);
+    }
+
+    return pEntry->pRecord.get();
+}
+
+REFR* RecordCollection::GetObjectRefById(uint32_t aFormId) noexcept
+{
+    return Resolve(m_objectReferences, aFormId);
+}
+
+NPC* RecordCollection::GetNpcById(uint32_t aFormId) noexcept
+{
+    return Resolve(m_npcs, aFormId);
+}
+
+std::optional<uint32_t> RecordCollection::GetFormIdPrefix(const String& acPluginName) const noexcept
+{
+    for (const auto& plugin : m_plugins)
+    {
+        if (plugin.Name == acPluginName)
+            return plugin.FormIdPrefix;
+    }
+
+    return std::nullopt;
+}
+
+size_t RecordCollection::GetTableMemoryUsage() const noexcept
+{
+    return m_formTypes.GetMemoryUsage() + m_objectReferences.GetMemoryUsage() + m_climates.GetMemoryUsage() + m_npcs.GetMemoryUsage() +
+           m_containers.GetMemoryUsage() + m_gameSettings.GetMemoryUsage() + m_worlds.GetMemoryUsage() + m_navMeshes.GetMemoryUsage();
+}
+
 void RecordCollection::BuildReferences()
 {
-    for (auto& [_, navmesh] : m_navMeshes)
+    for (auto& world : m_worlds)
+        world.m_navMeshRefs.clear();
+
+    for (const auto& navmesh : m_navMeshes)
     {
         if (navmesh.m_navMesh.m_worldSpaceId)
         {
-            auto& world = GetWorldById(navmesh.m_navMesh.m_worldSpaceId);
-            world.m_navMeshRefs.push_back(&navmesh);
+            // Records are not moved once sealed, the pointer stays valid for the lifetime of the collection
+            if (auto* pWorld = m_worlds.Find(navmesh.m_navMesh.m_worldSpaceId))
+                pWorld->m_navMeshRefs.push_back(&navmesh);
         }
     }
 }
+
+void RecordCollection::Merge(RecordCollection&& aPlugin) noexcept
+{
+    // Overridden records keep their plugin mapped, the other records of that plugin still need it
+    const auto cPluginOffset = static_cast<uint32_t>(m_plugins.size());
+    for (auto& plugin : aPlugin.m_plugins)
+        m_plugins.push_back(std::move(plugin));
+
+    aPlugin.m_plugins.clear();
+
+    m_formTypes.Append(std::move(aPlugin.m_formTypes));
+    MergeTable(m_objectReferences, aPlugin.m_objectReferences, cPluginOffset);
+    m_climates.Append(std::move(aPlugin.m_climates));
+    MergeTable(m_npcs, aPlugin.m_npcs, cPluginOffset);
+    m_containers.Append(std::move(aPlugin.m_containers));
+    m_gameSettings.Append(std::move(aPlugin.m_gameSettings));
+    m_worlds.Append(std::move(aPlugin.m_worlds));
+    m_navMeshes.Append(std::move(aPlugin.m_navMeshes));
+}
+
+void RecordCollection::Seal() noexcept
+{
+    m_formTypes.Seal();
+    m_objectReferences.Seal();
+    m_climates.Seal();
+    m_npcs.Seal();
+    m_containers.Seal();
+    m_gameSettings.Seal();
+    m_worlds.Seal();
+    m_navMeshes.Seal();
+}
 } // namespace ESLoader
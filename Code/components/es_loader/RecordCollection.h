@@ -1,5 +1,8 @@
 #pragma once
 
+#include "MappedFile.h"
+#include "RecordTable.h"
+
 #include "Records/CLMT.h"
 #include "Records/CONT.h"
 #include "Records/GMST.h"
@@ -10,43 +13,103 @@
 
 namespace ESLoader
 {
+/**
+ * @brief A plugin kept mapped for the records that are parsed on demand.
+ */
+struct PluginFile
+{
+    String Name;
+    MappedFile File;
+    Map<uint8_t, uint32_t> FormIdPrefixes;
+    // Of the plugin's own records in the load order
+    uint32_t FormIdPrefix = 0;
+};
+
+/**
+ * @brief Location of a record in its plugin, the record is parsed and kept the first time it is queried.
+ */
+template <class T> struct LazyRecord
+{
+    static constexpr uint32_t kNoPlugin = std::numeric_limits<uint32_t>::max();
+
+    uint32_t Plugin = kNoPlugin;
+    // Of the record header, plugins cannot be larger than 4 GiB
+    uint32_t Offset = 0;
+    UniquePtr<T> pRecord;
+};
+
+/**
+ * @brief Records of a load order.
+ *
+ * Object references and NPCs are by far the most numerous records, they stay in their mapped plugin until
+ * they are looked up. Their getters parse them on first use and are therefore not thread safe, the other
+ * getters are. No getter adds records, they return nullptr when the load order does not have the record.
+ */
 struct RecordCollection
 {
     friend class TESFile;
+    friend class RecordCache;
+    friend class RecordCacheTest;
 
     FormEnum GetFormType(uint32_t aFormId) const noexcept
     {
-        auto record = m_allRecords.find(aFormId);
-        if (record == std::end(m_allRecords))
+        const auto* pType = m_formTypes.Find(aFormId);
+        if (!pType)
         {
             spdlog::error("Record not found for form id {:X}", aFormId);
             return FormEnum::EMPTY_ID;
         }
 
-        return record->second.GetType();
+        return *pType;
     }
 
-    bool HasAnyRecords() const noexcept { return m_allRecords.size(); }
+    bool HasAnyRecords() const noexcept { return !m_formTypes.Empty(); }
+
+    REFR* GetObjectRefById(uint32_t aFormId) noexcept;
+    const CLMT* GetClimateById(uint32_t aFormId) const noexcept { return m_climates.Find(aFormId); }
+    NPC* GetNpcById(uint32_t aFormId) noexcept;
+    const CONT* GetContainerById(uint32_t aFormId) const noexcept { return m_containers.Find(aFormId); }
+    const GMST* GetGameSettingById(uint32_t aFormId) const noexcept { return m_gameSettings.Find(aFormId); }
+    const WRLD* GetWorldById(uint32_t aFormId) const noexcept { return m_worlds.Find(aFormId); }
+    const NAVM* GetNavMeshById(uint32_t aFormId) const noexcept { return m_navMeshes.Find(aFormId); }
 
-    REFR& GetObjectRefById(uint32_t aFormId) noexcept { return m_objectReferences[aFormId]; }
-    CLMT& GetClimateById(uint32_t aFormId) noexcept { return m_climates[aFormId]; }
-    NPC& GetNpcById(uint32_t aFormId) noexcept { return m_npcs[aFormId]; }
-    CONT& GetContainerById(uint32_t aFormId) noexcept { return m_containers[aFormId]; }
-    GMST& GetGameSettingById(uint32_t aFormId) noexcept { return m_gameSettings[aFormId]; }
-    WRLD& GetWorldById(uint32_t aFormId) noexcept { return m_worlds[aFormId]; }
-    NAVM& GetNavMeshById(uint32_t aFormId) noexcept { return m_navMeshes[aFormId]; }
+    const RecordTable<FormEnum>& GetFormTypes() const noexcept { return m_formTypes; }
+    const RecordTable<CONT>& GetContainers() const noexcept { return m_containers; }
+    const RecordTable<WRLD>& GetWorlds() const noexcept { return m_worlds; }
+    // Lazy records count whether they were parsed or not
+    size_t GetObjectRefCount() const noexcept { return m_objectReferences.Size(); }
+    size_t GetNpcCount() const noexcept { return m_npcs.Size(); }
+
+    /**
+     * @brief Returns the prefix given to the form ids of a plugin, std::nullopt if it is not in the load order.
+     */
+    std::optional<uint32_t> GetFormIdPrefix(const String& acPluginName) const noexcept;
+
+    // Memory held by the tables, not counting what the records allocate
+    size_t GetTableMemoryUsage() const noexcept;
 
     void BuildReferences();
+    /**
+     * @brief Moves the records of a plugin loaded after this one in, its records override ours once sealed.
+     */
+    void Merge(RecordCollection&& aPlugin) noexcept;
+    /**
+     * @brief Sorts the tables and drops overridden records, must be called once every plugin is merged.
+     */
+    void Seal() noexcept;
 
 private:
-    Map<uint32_t, Record> m_allRecords{};
-    Map<uint32_t, REFR> m_objectReferences{};
-    Map<uint32_t, CLMT> m_climates{};
-    Map<uint32_t, NPC> m_npcs{};
-    Map<uint32_t, CONT> m_containers{};
-    Map<uint32_t, GMST> m_gameSettings{};
-    Map<uint32_t, WRLD> m_worlds{};
-    Map<uint32_t, NAVM> m_navMeshes{};
+    template <class T> T* Resolve(RecordTable<LazyRecord<T>>& aTable, uint32_t aFormId) noexcept;
+
+    Vector<PluginFile> m_plugins{};
+    RecordTable<FormEnum> m_formTypes{};
+    RecordTable<LazyRecord<REFR>> m_objectReferences{};
+    RecordTable<CLMT> m_climates{};
+    RecordTable<LazyRecord<NPC>> m_npcs{};
+    RecordTable<CONT> m_containers{};
+    RecordTable<GMST> m_gameSettings{};
+    RecordTable<WRLD> m_worlds{};
+    RecordTable<NAVM> m_navMeshes{};
 };
 
 } // namespace ESLoader
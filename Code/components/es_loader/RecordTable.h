@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <numeric>
+
+namespace ESLoader
+{
+/**
+ * @brief Records of one type, stored flat and sorted by form id once sealed.
+ *
+ * Records are appended while plugins are indexed and merged, a record added later overrides one added before
+ * with the same form id. Seal then sorts the table once, after which it is only looked up. Form ids are kept
+ * apart from the records so a lookup only walks the id array, and the first and last record of every load order
+ * index are known so the search only covers the records of one plugin.
+ */
+template <class T> class RecordTable
+{
+public:
+    void Reserve(size_t aCount)
+    {
+        m_ids.reserve(aCount);
+        m_records.reserve(aCount);
+    }
+
+    void Add(uint32_t aFormId, T&& aRecord)
+    {
+        m_ids.push_back(aFormId);
+        m_records.push_back(std::move(aRecord));
+        m_sealed = false;
+    }
+
+    /**
+     * @brief Appends the records of a plugin loaded after this one, they override ours on Seal.
+     */
+    void Append(RecordTable&& aOverrides)
+    {
+        if (m_ids.empty())
+        {
+            *this = std::move(aOverrides);
+            m_sealed = false;
+            return;
+        }
+
+        Reserve(m_ids.size() + aOverrides.m_ids.size());
+        m_ids.insert(std::end(m_ids), std::begin(aOverrides.m_ids), std::end(aOverrides.m_ids));
+        std::move(std::begin(aOverrides.m_records), std::end(aOverrides.m_records), std::back_inserter(m_records));
+        m_sealed = false;
+
+        aOverrides = {};
+    }
+
+    /**
+     * @brief Sorts the table and drops overridden records, lookups are only valid on a sealed table.
+     */
+    void Seal()
+    {
+        if (m_sealed)
+            return;
+
+        // Plugins store most records in form id order, a table read back from the cache is already sorted
+        if (std::adjacent_find(std::begin(m_ids), std::end(m_ids), std::greater_equal<>()) != std::end(m_ids))
+        {
+            Vector<uint32_t> order(m_ids.size());
+            std::iota(std::begin(order), std::end(order), 0);
+            std::stable_sort(std::begin(order), std::end(order), [this](uint32_t aLhs, uint32_t aRhs) { return m_ids[aLhs] < m_ids[aRhs]; });
+
+            Vector<uint32_t> ids;
+            Vector<T> records;
+            ids.reserve(order.size());
+            records.reserve(order.size());
+
+            for (size_t i = 0; i < order.size(); ++i)
+            {
+                // Only the last added record of a run of equal ids is kept
+                if (i + 1 < order.size() && m_ids[order[i]] == m_ids[order[i + 1]])
+                    continue;
+
+                ids.push_back(m_ids[order[i]]);
+                records.push_back(std::move(m_records[order[i]]));
+            }
+
+            m_ids = std::move(ids);
+            m_records = std::move(records);
+        }
+
+        m_ids.shrink_to_fit();
+        m_records.shrink_to_fit();
+
+        // m_ranges[i] is the first record whose load order index is at least i
+        size_t position = 0;
+        for (uint32_t i = 0; i < m_ranges.size(); ++i)
+        {
+            while (position < m_ids.size() && (m_ids[position] >> 24) < i)
+                ++position;
+
+            m_ranges[i] = static_cast<uint32_t>(position);
+        }
+
+        m_sealed = true;
+    }
+
+    /**
+     * @brief Returns the record with this form id, nullptr if the load order does not have one.
+     */
+    [[nodiscard]] T* Find(uint32_t aFormId) noexcept { return const_cast<T*>(std::as_const(*this).Find(aFormId)); }
+
+    [[nodiscard]] const T* Find(uint32_t aFormId) const noexcept
+    {
+        assert(m_sealed);
+
+        const auto cLoadOrderIndex = aFormId >> 24;
+        const auto cBegin = std::begin(m_ids) + m_ranges[cLoadOrderIndex];
+        const auto cEnd = std::begin(m_ids) + m_ranges[cLoadOrderIndex + 1];
+
+        const auto cItor = std::lower_bound(cBegin, cEnd, aFormId);
+        if (cItor == cEnd || *cItor != aFormId)
+            return nullptr;
+
+        return &m_records[cItor - std::begin(m_ids)];
+    }
+
+    [[nodiscard]] bool IsSealed() const noexcept { return m_sealed; }
+    [[nodiscard]] size_t Size() const noexcept { return m_ids.size(); }
+    [[nodiscard]] bool Empty() const noexcept { return m_ids.empty(); }
+
+    [[nodiscard]] uint32_t GetId(size_t aIndex) const noexcept { return m_ids[aIndex]; }
+    [[nodiscard]] T& GetRecord(size_t aIndex) noexcept { return m_records[aIndex]; }
+    [[nodiscard]] const T& GetRecord(size_t aIndex) const noexcept { return m_records[aIndex]; }
+
+    // Does not include what the records themselves allocate
+    [[nodiscard]] size_t GetMemoryUsage() const noexcept
+    {
+        return m_ids.capacity() * sizeof(uint32_t) + m_records.capacity() * sizeof(T) + sizeof(m_ranges);
+    }
+
+    auto begin() noexcept { return std::begin(m_records); }
+    auto end() noexcept { return std::end(m_records); }
+    auto begin() const noexcept { return std::begin(m_records); }
+    auto end() const noexcept { return std::end(m_records); }
+
+private:
+    Vector<uint32_t> m_ids{};
+    Vector<T> m_records{};
+    std::array<uint32_t, 257> m_ranges{};
+    bool m_sealed = true;
+};
+} // namespace ESLoader
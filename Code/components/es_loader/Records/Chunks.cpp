@@ -174,19 +174,26 @@ DNAM::DNAM(Buffer::Reader& aReader)
     aReader.ReadBytes(reinterpret_cast<uint8_t*>(&m_waterLevel), 4);
 }
 
-NVNM::NVNM(Buffer::Reader& aReader)
+NVNM::NVNM(Buffer::Reader& aReader, Map<uint8_t, uint32_t>& aParentToFormIdPrefix)
 {
     aReader.ReadBytes(reinterpret_cast<uint8_t*>(&m_unknown), 4);
     aReader.ReadBytes(reinterpret_cast<uint8_t*>(&m_locactionMarker), 4);
-    aReader.ReadBytes(reinterpret_cast<uint8_t*>(&m_worldSpaceId), 4);
-    if (m_worldSpaceId == 0)
+
+    // A null world space means the navmesh belongs to an interior cell, checked before the id is resolved
+    uint32_t worldSpaceId = 0;
+    aReader.ReadBytes(reinterpret_cast<uint8_t*>(&worldSpaceId), 4);
+    aReader.Reverse(4);
+
+    if (worldSpaceId == 0)
     {
-        uint32_t id = 0;
-        aReader.ReadBytes(reinterpret_cast<uint8_t*>(&id), 4);
-        m_cellId = id;
+        aReader.Advance(4);
+        m_worldSpaceId = 0;
+        m_cellId = ReadFormId(aReader, aParentToFormIdPrefix);
     }
     else
     {
+        m_worldSpaceId = ReadFormId(aReader, aParentToFormIdPrefix);
+
         int16_t tmp = 0;
         aReader.ReadBytes(reinterpret_cast<uint8_t*>(&tmp), 2);
         m_gridY = tmp;
@@ -216,7 +223,7 @@ NVNM::NVNM(Buffer::Reader& aReader)
     for (auto& connection : m_connections)
     {
         aReader.ReadBytes(reinterpret_cast<uint8_t*>(&connection.m_unk), sizeof(connection.m_unk));
-        aReader.ReadBytes(reinterpret_cast<uint8_t*>(&connection.m_navMeshId), sizeof(connection.m_navMeshId));
+        connection.m_navMeshId = ReadFormId(aReader, aParentToFormIdPrefix);
         aReader.ReadBytes(reinterpret_cast<uint8_t*>(&connection.tri), sizeof(connection.tri));
     }
 
@@ -227,7 +234,7 @@ NVNM::NVNM(Buffer::Reader& aReader)
     {
         aReader.ReadBytes(reinterpret_cast<uint8_t*>(&doorTri.tri), sizeof(doorTri.tri));
         aReader.ReadBytes(reinterpret_cast<uint8_t*>(&doorTri.m_unk), sizeof(doorTri.m_unk));
-        aReader.ReadBytes(reinterpret_cast<uint8_t*>(&doorTri.m_doorId), sizeof(doorTri.m_doorId));
+        doorTri.m_doorId = ReadFormId(aReader, aParentToFormIdPrefix);
     }
 
     int32_t coverTriangleCount = 0;
@@ -333,7 +333,7 @@ struct DNAM
 struct NVNM
 {
     NVNM() {}
-    NVNM(Buffer::Reader& aReader);
+    NVNM(Buffer::Reader& aReader, TiltedPhoques::Map<uint8_t, uint32_t>& aParentToFormIdPrefix);
 
     struct Tri
     {
@@ -9,7 +9,7 @@ void NAVM::ParseChunks(NAVM& aSourceRecord, Map<uint8_t, uint32_t>& aParentToFor
         {
             switch (aChunkId)
             {
-            case ChunkId::NVNM_ID: m_navMesh = Chunks::NVNM{aReader}; break;
+            case ChunkId::NVNM_ID: m_navMesh = Chunks::NVNM{aReader, aParentToFormIdPrefix}; break;
             }
         });
 }
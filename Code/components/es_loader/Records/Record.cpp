@@ -1,7 +1,42 @@
 #include "Record.h"
 
+#include <TiltedCore/ViewBuffer.hpp>
 #include <zlib.h>
 
+namespace
+{
+// Records are decompressed by the indexing workers and on lookups, each thread reuses its stream and output
+struct InflateContext
+{
+    InflateContext() noexcept
+    {
+        Stream.zalloc = Z_NULL;
+        Stream.zfree = Z_NULL;
+        Stream.opaque = Z_NULL;
+        Stream.next_in = Z_NULL;
+        Stream.avail_in = 0;
+
+        Initialized = inflateInit(&Stream) == Z_OK;
+    }
+
+    ~InflateContext() noexcept
+    {
+        if (Initialized)
+            inflateEnd(&Stream);
+    }
+
+    z_stream Stream{};
+    bool Initialized = false;
+    Buffer Output{};
+};
+
+InflateContext& GetInflateContext() noexcept
+{
+    static thread_local InflateContext s_context;
+    return s_context;
+}
+} // namespace
+
 void Record::CopyRecordData(Record& aRhs)
 {
     m_formType = aRhs.m_formType;
@@ -21,20 +56,26 @@ void Record::SetBaseId(uint32_t aBaseId)
 
 void Record::IterateChunks(const std::function<void(ChunkId, Buffer::Reader&)>& aCallback)
 {
-    Buffer buffer(reinterpret_cast<uint8_t*>(this) + sizeof(Record), m_dataSize);
+    // Chunks are read in place, only compressed records are copied out
+    ViewBuffer buffer(reinterpret_cast<uint8_t*>(this) + sizeof(Record), m_dataSize);
     Buffer::Reader reader(&buffer);
 
-    Buffer pDecompressed;
+    std::optional<ViewBuffer> decompressed;
     if (Compressed())
     {
         uint32_t size = 0;
         reader.ReadBytes(reinterpret_cast<uint8_t*>(&size), 4);
-        pDecompressed.Resize(size);
         const uint32_t fieldSize = m_dataSize - 4;
 
-        DecompressChunkData(reader.GetDataAtPosition(), fieldSize, pDecompressed.GetWriteData(), pDecompressed.GetSize());
+        // Only valid until the next compressed record is read on this thread
+        auto& output = GetInflateContext().Output;
+        if (output.GetSize() < size)
+            output.Resize(size);
+
+        DecompressChunkData(reader.GetDataAtPosition(), fieldSize, output.GetWriteData(), size);
 
-        reader = Buffer::Reader(&pDecompressed);
+        decompressed.emplace(output.GetWriteData(), size);
+        reader = Buffer::Reader(&*decompressed);
     }
 
     uint32_t largeDataSize = 0;
@@ -69,22 +110,25 @@ void Record::IterateChunks(const std::function<void(ChunkId, Buffer::Reader&)>&
 
 void Record::DecompressChunkData(const void* apCompressedData, size_t aCompressedSize, void* apDecompressedData, size_t aDecompressedSize)
 {
-    z_stream compressionStream;
+    auto& context = GetInflateContext();
+    if (!context.Initialized)
+    {
+        spdlog::error("Failed to decompress chunk of data: inflate stream could not be initialized");
+        return;
+    }
+
+    // Resetting keeps the window and state allocated by inflateInit
+    auto& compressionStream = context.Stream;
+    inflateReset(&compressionStream);
+
     compressionStream.next_in = (Bytef*)apCompressedData;
     compressionStream.avail_in = (uInt)(aCompressedSize);
     compressionStream.next_out = (Bytef*)apDecompressedData;
     compressionStream.avail_out = (uInt)aDecompressedSize;
-    compressionStream.zalloc = Z_NULL;
-    compressionStream.zfree = Z_NULL;
-    compressionStream.opaque = Z_NULL;
 
-    inflateInit(&compressionStream);
-    int res = inflate(&compressionStream, Z_NO_FLUSH);
-    if (res < Z_OK)
+    const int res = inflate(&compressionStream, Z_FINISH);
+    if (res != Z_STREAM_END)
         spdlog::error("Failed to decompress chunk of data (inflate): {}.", res);
-    res = inflateEnd(&compressionStream);
-    if (res < Z_OK)
-        spdlog::error("Failed to decompress chunk of data: {}", res);
 }
 
 void Record::DiscoverChunks()
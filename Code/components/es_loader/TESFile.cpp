@@ -1,12 +1,12 @@
 #include "TESFile.h"
 
 #include <filesystem>
-#include <fstream>
+#include <TiltedCore/ViewBuffer.hpp>
 
 namespace ESLoader
 {
-TESFile::TESFile(Map<String, uint8_t>& aMasterFiles)
-    : m_masterFiles(aMasterFiles)
+TESFile::TESFile(const Map<String, uint8_t>& acMasterFiles)
+    : m_masterFiles(acMasterFiles)
 {
 }
 
@@ -26,27 +26,25 @@ bool TESFile::LoadFile(const std::filesystem::path& acPath) noexcept
 {
     m_filename = acPath.filename().string();
 
-    const uintmax_t fileSize = std::filesystem::file_size(acPath);
-    m_buffer.Resize(fileSize);
-
-    std::ifstream file(acPath, std::ios::binary);
-    if (file.fail())
+    if (!m_file.Open(acPath))
     {
         spdlog::error("Failed to open plugin {}", m_filename);
         return false;
     }
 
-    file.read(reinterpret_cast<char*>(m_buffer.GetWriteData()), fileSize);
-
     return true;
 }
 
 bool TESFile::IndexRecords(RecordCollection& aRecordCollection) noexcept
 {
-    if (m_filename.size() == 0)
+    if (m_filename.size() == 0 || !m_file.IsOpen())
         return false;
 
-    Buffer::Reader reader(&m_buffer);
+    m_pluginIndex = static_cast<uint32_t>(aRecordCollection.m_plugins.size());
+
+    // The view never writes, the mapping is read only
+    ViewBuffer view(const_cast<uint8_t*>(m_file.GetData()), m_file.GetSize());
+    Buffer::Reader reader(&view);
 
     while (true)
     {
@@ -54,6 +52,9 @@ bool TESFile::IndexRecords(RecordCollection& aRecordCollection) noexcept
             break;
     }
 
+    // Lazy records are parsed from the mapping later on, the collection keeps it alive
+    aRecordCollection.m_plugins.push_back({m_filename, std::move(m_file), m_parentToFormIdPrefix, m_formIdPrefix});
+
     return true;
 }
 
@@ -80,7 +81,13 @@ bool TESFile::ReadGroupOrRecord(Buffer::Reader& aReader, RecordCollection& aReco
     }
     else // Records
     {
-        Record* pRecord = reinterpret_cast<Record*>(m_buffer.GetWriteData() + aReader.GetBytePosition());
+        const auto cOffset = static_cast<uint32_t>(aReader.GetBytePosition());
+        Record* pRecord = reinterpret_cast<Record*>(const_cast<uint8_t*>(m_file.GetData()) + cOffset);
+
+        // The id SetBaseId gives the parsed record
+        uint32_t formId = 0;
+        if (pRecord->GetType() != FormEnum::TES4)
+            formId = (pRecord->GetFormId() & 0x00FFFFFF) + GetFormIdPrefix(pRecord->GetFormId(), m_parentToFormIdPrefix);
 
         switch (pRecord->GetType())
         {
@@ -95,7 +102,12 @@ bool TESFile::ReadGroupOrRecord(Buffer::Reader& aReader, RecordCollection& aReco
             uint8_t parentId = 0;
             for (const Chunks::MAST& master : fileHeader.m_masterFiles)
             {
-                m_parentToFormIdPrefix[parentId] = ((uint32_t)m_masterFiles[master.m_masterName]) << 24;
+                // Shared between the plugins being indexed, must not be inserted into
+                const auto masterId = m_masterFiles.find(master.m_masterName);
+                if (masterId == std::end(m_masterFiles))
+                    spdlog::warn("Master {} of {} is not in the load order", master.m_masterName, m_filename);
+
+                m_parentToFormIdPrefix[parentId] = masterId == std::end(m_masterFiles) ? 0 : ((uint32_t)masterId->second) << 24;
                 parentId++;
             }
 
@@ -104,58 +116,45 @@ bool TESFile::ReadGroupOrRecord(Buffer::Reader& aReader, RecordCollection& aReco
             break;
         }
         // case FormEnum::ACHR:
-        case FormEnum::REFR:
-        {
-            REFR parsedRecord = CopyAndParseRecord<REFR>(pRecord);
-            aRecordCollection.m_objectReferences[parsedRecord.GetFormId()] = parsedRecord;
-            break;
-        }
+        case FormEnum::REFR: AddLazyRecord(aRecordCollection.m_objectReferences, formId, cOffset); break;
         case FormEnum::CELL: break;
         case FormEnum::CLMT:
         {
-            CLMT parsedRecord = CopyAndParseRecord<CLMT>(pRecord);
-            aRecordCollection.m_climates[parsedRecord.GetFormId()] = parsedRecord;
-            break;
-        }
-        case FormEnum::NPC_:
-        {
-            NPC parsedRecord = CopyAndParseRecord<NPC>(pRecord);
-            aRecordCollection.m_npcs[parsedRecord.GetFormId()] = parsedRecord;
+            CLMT parsedRecord = CopyAndParseRecord<CLMT>(pRecord, m_parentToFormIdPrefix);
+            aRecordCollection.m_climates.Add(parsedRecord.GetFormId(), std::move(parsedRecord));
             break;
         }
+        case FormEnum::NPC_: AddLazyRecord(aRecordCollection.m_npcs, formId, cOffset); break;
         case FormEnum::CONT:
         {
-            CONT parsedRecord = CopyAndParseRecord<CONT>(pRecord);
-            aRecordCollection.m_containers[parsedRecord.GetFormId()] = parsedRecord;
+            CONT parsedRecord = CopyAndParseRecord<CONT>(pRecord, m_parentToFormIdPrefix);
+            aRecordCollection.m_containers.Add(parsedRecord.GetFormId(), std::move(parsedRecord));
             break;
         }
         case FormEnum::GMST:
         {
-            GMST parsedRecord = CopyAndParseRecord<GMST>(pRecord);
-            aRecordCollection.m_gameSettings[parsedRecord.GetFormId()] = parsedRecord;
+            GMST parsedRecord = CopyAndParseRecord<GMST>(pRecord, m_parentToFormIdPrefix);
+            aRecordCollection.m_gameSettings.Add(parsedRecord.GetFormId(), std::move(parsedRecord));
             break;
         }
         case FormEnum::WRLD:
         {
-            WRLD parsedRecord = CopyAndParseRecord<WRLD>(pRecord);
-            aRecordCollection.m_worlds[parsedRecord.GetFormId()] = parsedRecord;
+            WRLD parsedRecord = CopyAndParseRecord<WRLD>(pRecord, m_parentToFormIdPrefix);
+            aRecordCollection.m_worlds.Add(parsedRecord.GetFormId(), std::move(parsedRecord));
+            break;
         }
         case FormEnum::NAVM:
         {
-            NAVM parsedRecord = CopyAndParseRecord<NAVM>(pRecord);
-            aRecordCollection.m_navMeshes[parsedRecord.GetFormId()] = parsedRecord;
+            NAVM parsedRecord = CopyAndParseRecord<NAVM>(pRecord, m_parentToFormIdPrefix);
+            aRecordCollection.m_navMeshes.Add(parsedRecord.GetFormId(), std::move(parsedRecord));
+            break;
         }
         }
 
         // pRecord->DiscoverChunks();
 
         if (pRecord->GetType() != FormEnum::TES4)
-        {
-            Record record;
-            record.CopyRecordData(*pRecord);
-            record.SetBaseId(GetFormIdPrefix(pRecord->GetFormId(), m_parentToFormIdPrefix));
-            aRecordCollection.m_allRecords[pRecord->GetFormId()] = *pRecord;
-        }
+            aRecordCollection.m_formTypes.Add(formId, pRecord->GetType());
 
         aReader.Advance(sizeof(Record) + size);
     }
@@ -166,14 +165,14 @@ bool TESFile::ReadGroupOrRecord(Buffer::Reader& aReader, RecordCollection& aReco
 template <typename T>
 concept ExpectsGRUP = requires(T t) { &T::ParseGRUP; };
 
-template <class T> T TESFile::CopyAndParseRecord(Record* pRecordHeader)
+template <class T> T TESFile::CopyAndParseRecord(Record* pRecordHeader, Map<uint8_t, uint32_t>& aParentToFormIdPrefix)
 {
     T* pRecord = reinterpret_cast<T*>(pRecordHeader);
 
     T parsedRecord;
     parsedRecord.CopyRecordData(*pRecord);
-    parsedRecord.SetBaseId(TESFile::GetFormIdPrefix(pRecord->GetFormId(), m_parentToFormIdPrefix));
-    parsedRecord.ParseChunks(*pRecord, m_parentToFormIdPrefix);
+    parsedRecord.SetBaseId(TESFile::GetFormIdPrefix(pRecord->GetFormId(), aParentToFormIdPrefix));
+    parsedRecord.ParseChunks(*pRecord, aParentToFormIdPrefix);
 
     // If the record expects a subgroup right after, parse it? Or do we not care since we load everything?
     if constexpr (ExpectsGRUP<T>)
@@ -184,6 +183,18 @@ template <class T> T TESFile::CopyAndParseRecord(Record* pRecordHeader)
     return parsedRecord;
 }
 
+// Lazy records are parsed by the collection
+template REFR TESFile::CopyAndParseRecord<REFR>(Record*, Map<uint8_t, uint32_t>&);
+template NPC TESFile::CopyAndParseRecord<NPC>(Record*, Map<uint8_t, uint32_t>&);
+
+template <class T> void TESFile::AddLazyRecord(RecordTable<LazyRecord<T>>& aTable, uint32_t aFormId, uint32_t aOffset) noexcept
+{
+    LazyRecord<T> entry;
+    entry.Plugin = m_pluginIndex;
+    entry.Offset = aOffset;
+    aTable.Add(aFormId, std::move(entry));
+}
+
 template <class T> void TESFile::ParseGRUP(Record* pRecordHeader, T& aRecord)
 {
     // aRecord.ParseGRUP();
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <MappedFile.h>
 #include <RecordCollection.h>
 
 #include <Records/CLMT.h>
@@ -15,24 +16,28 @@ class TESFile
 {
 public:
     TESFile() = default;
-    TESFile(TiltedPhoques::Map<String, uint8_t>& aMasterFiles);
+    TESFile(const TiltedPhoques::Map<String, uint8_t>& acMasterFiles);
 
     void Setup(uint8_t aStandardId);
     void Setup(uint16_t aLiteId);
+    // Maps the file, it stays mapped until the TESFile is destroyed
     bool LoadFile(const std::filesystem::path& acPath) noexcept;
+    // Does not touch state shared with other plugins, plugins can be indexed in parallel into their own collection
     bool IndexRecords(RecordCollection& aRecordCollection) noexcept;
 
     [[nodiscard]] static uint32_t GetFormIdPrefix(uint32_t aFormId, TiltedPhoques::Map<uint8_t, uint32_t>& aParentToFormIdPrefix) noexcept;
 
+    template <class T> static T CopyAndParseRecord(Record* pRecordHeader, TiltedPhoques::Map<uint8_t, uint32_t>& aParentToFormIdPrefix);
+
 private:
     bool ReadGroupOrRecord(Buffer::Reader& aReader, RecordCollection& aRecordCollection) noexcept;
 
-    template <class T> T CopyAndParseRecord(Record* pRecordHeader);
+    template <class T> void AddLazyRecord(RecordTable<LazyRecord<T>>& aTable, uint32_t aFormId, uint32_t aOffset) noexcept;
 
     template <class T> void ParseGRUP(Record* pRecordHeader, T& aRecord);
 
     String m_filename = "";
-    Buffer m_buffer{};
+    MappedFile m_file{};
 
     union
     {
@@ -40,8 +45,10 @@ private:
         uint16_t m_liteId;
     };
     uint32_t m_formIdPrefix = 0;
+    // Index of this plugin in the collection it is indexed into
+    uint32_t m_pluginIndex = 0;
 
-    TiltedPhoques::Map<String, uint8_t>& m_masterFiles;
+    const TiltedPhoques::Map<String, uint8_t>& m_masterFiles;
     TiltedPhoques::Map<uint8_t, uint32_t> m_parentToFormIdPrefix{};
 };
 
@@ -0,0 +1,58 @@
+#include <ChatSanitizer.h>
+
+namespace
+{
+// The whitespace class of ECMAScript regular expressions in the classic locale
+bool IsSpace(char aCharacter) noexcept
+{
+    return aCharacter == ' ' || (aCharacter >= '\t' && aCharacter <= '\r');
+}
+} // namespace
+
+void SanitizeChatText(std::string_view aInput, TiltedPhoques::String& aOutput) noexcept
+{
+    aOutput.clear();
+    aOutput.reserve(aInput.size());
+
+    size_t position = 0;
+    while (position < aInput.size())
+    {
+        const auto cOpen = aInput.find('<', position);
+        if (cOpen == std::string_view::npos)
+            break;
+
+        // Without a closing bracket further on, nothing left can be a tag
+        const auto cClose = aInput.find('>', cOpen + 1);
+        if (cClose == std::string_view::npos)
+            break;
+
+        // An empty tag is kept as text
+        if (cClose == cOpen + 1)
+        {
+            aOutput.append(aInput.substr(position, cClose - position));
+            position = cClose;
+            continue;
+        }
+
+        aOutput.append(aInput.substr(position, cOpen - position));
+        position = cClose + 1;
+
+        // Whitespace is only dropped when another tag may follow
+        auto end = position;
+        while (end < aInput.size() && IsSpace(aInput[end]))
+            ++end;
+
+        if (end > position && end < aInput.size() && aInput[end] == '<')
+            position = end;
+    }
+
+    aOutput.append(aInput.substr(position));
+}
+
+TiltedPhoques::String SanitizeChatText(std::string_view aInput) noexcept
+{
+    TiltedPhoques::String output;
+    SanitizeChatText(aInput, output);
+
+    return output;
+}
@@ -0,0 +1,10 @@
+#pragma once
+
+/**
+ * @brief Strips markup from chat text before it reaches the overlay.
+ *
+ * Removes every <tag>, along with the whitespace separating a tag from the next one, in a single pass.
+ * The output is never larger than the input, it is reserved once and nothing else is allocated.
+ */
+void SanitizeChatText(std::string_view aInput, TiltedPhoques::String& aOutput) noexcept;
+[[nodiscard]] TiltedPhoques::String SanitizeChatText(std::string_view aInput) noexcept;
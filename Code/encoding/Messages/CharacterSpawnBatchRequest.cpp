@@ -0,0 +1,151 @@
+#include <Messages/CharacterSpawnBatchRequest.h>
+#include <TiltedCore/Serialization.hpp>
+
+namespace
+{
+constexpr size_t kMaxAppearanceSize = 1 << 20;
+
+Buffer& GetSpawnBuffer() noexcept
+{
+    static thread_local Buffer s_buffer(CharacterSpawnBatchRequest::kMaxSpawnSize);
+    return s_buffer;
+}
+
+void WriteBlob(TiltedPhoques::Buffer::Writer& aWriter, std::span<const uint8_t> aData) noexcept
+{
+    Serialization::WriteVarInt(aWriter, aData.size());
+    aWriter.WriteBytes(aData.data(), aData.size());
+}
+
+// Returns false if the packet is malformed, the rest of the spawns cannot be located then
+bool ReadBlob(TiltedPhoques::Buffer::Reader& aReader, Buffer& aBuffer) noexcept
+{
+    const auto cSize = Serialization::ReadVarInt(aReader);
+    if (cSize > aBuffer.GetSize())
+        return false;
+
+    aReader.ReadBytes(aBuffer.GetWriteData(), cSize);
+    return true;
+}
+} // namespace
+
+void CharacterSpawnBatchRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    // Spawns carry their own appearance, they are deduplicated on top of the ones already in the table
+    Vector<std::string_view> appearances;
+    appearances.reserve(Appearances.size() + AppearanceViews.size() + Spawns.size());
+
+    TiltedPhoques::Map<std::string_view, uint32_t> appearanceIds;
+    auto getAppearanceId = [&](const String& acAppearance) {
+        const auto [itor, inserted] = appearanceIds.try_emplace(std::string_view(acAppearance), static_cast<uint32_t>(appearances.size()));
+        if (inserted)
+            appearances.push_back(acAppearance);
+
+        return itor->second;
+    };
+
+    for (const auto& appearance : Appearances)
+    {
+        appearanceIds.try_emplace(std::string_view(appearance), static_cast<uint32_t>(appearances.size()));
+        appearances.push_back(appearance);
+    }
+
+    for (const auto appearance : AppearanceViews)
+    {
+        appearanceIds.try_emplace(appearance, static_cast<uint32_t>(appearances.size()));
+        appearances.push_back(appearance);
+    }
+
+    Vector<uint32_t> spawnAppearanceIds;
+    spawnAppearanceIds.reserve(Spawns.size());
+
+    for (const auto& spawn : Spawns)
+        spawnAppearanceIds.push_back(getAppearanceId(spawn.AppearanceBuffer));
+
+    Serialization::WriteVarInt(aWriter, appearances.size());
+    // Written by hand so views don't have to be copied into a String first
+    for (const auto appearance : appearances)
+        WriteBlob(aWriter, {reinterpret_cast<const uint8_t*>(appearance.data()), appearance.size()});
+
+    Serialization::WriteVarInt(aWriter, Spawns.size() + EncodedSpawns.size());
+
+    auto& buffer = GetSpawnBuffer();
+
+    for (size_t i = 0; i < Spawns.size(); ++i)
+    {
+        Serialization::WriteVarInt(aWriter, spawnAppearanceIds[i]);
+
+        {
+            Buffer::Writer spawnWriter(&buffer);
+            Spawns[i].SerializeState(spawnWriter);
+            WriteBlob(aWriter, {buffer.GetWriteData(), spawnWriter.Size()});
+        }
+
+        {
+            Buffer::Writer spawnWriter(&buffer);
+            Spawns[i].SerializeContent(spawnWriter);
+            WriteBlob(aWriter, {buffer.GetWriteData(), spawnWriter.Size()});
+        }
+    }
+
+    for (const auto& spawn : EncodedSpawns)
+    {
+        Serialization::WriteVarInt(aWriter, spawn.AppearanceId);
+        WriteBlob(aWriter, spawn.State);
+        WriteBlob(aWriter, spawn.Content);
+    }
+}
+
+void CharacterSpawnBatchRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    ServerMessage::DeserializeRaw(aReader);
+
+    Appearances.clear();
+    Spawns.clear();
+
+    const auto cAppearanceCount = Serialization::ReadVarInt(aReader);
+    for (auto i = 0u; i < cAppearanceCount; ++i)
+    {
+        const auto cSize = Serialization::ReadVarInt(aReader);
+
+        // Malformed packet, don't let it allocate whatever it wants
+        if (cSize > kMaxAppearanceSize)
+            return;
+
+        auto& appearance = Appearances.emplace_back(cSize, '\0');
+        aReader.ReadBytes(reinterpret_cast<uint8_t*>(appearance.data()), cSize);
+    }
+
+    const auto cCount = Serialization::ReadVarInt(aReader);
+    Spawns.reserve(cCount);
+
+    auto& buffer = GetSpawnBuffer();
+
+    for (auto i = 0u; i < cCount; ++i)
+    {
+        const auto cAppearanceId = Serialization::ReadVarInt(aReader);
+        if (cAppearanceId >= Appearances.size())
+            return;
+
+        CharacterSpawnRequest spawn;
+        spawn.AppearanceBuffer = Appearances[cAppearanceId];
+
+        if (!ReadBlob(aReader, buffer))
+            return;
+
+        {
+            Buffer::Reader spawnReader(&buffer);
+            spawn.DeserializeState(spawnReader);
+        }
+
+        if (!ReadBlob(aReader, buffer))
+            return;
+
+        {
+            Buffer::Reader spawnReader(&buffer);
+            spawn.DeserializeContent(spawnReader);
+        }
+
+        Spawns.push_back(std::move(spawn));
+    }
+}
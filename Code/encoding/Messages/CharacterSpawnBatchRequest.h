@@ -0,0 +1,46 @@
+#pragma once
+
+#include "Message.h"
+#include <Messages/CharacterSpawnRequest.h>
+
+#include <span>
+
+using TiltedPhoques::String;
+
+struct CharacterSpawnBatchRequest final : ServerMessage
+{
+    static constexpr ServerOpcode Opcode = kCharacterSpawnBatchRequest;
+
+    CharacterSpawnBatchRequest()
+        : ServerMessage(Opcode)
+    {
+    }
+
+    void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
+
+    bool operator==(const CharacterSpawnBatchRequest& acRhs) const noexcept { return Spawns == acRhs.Spawns && GetOpcode() == acRhs.GetOpcode(); }
+
+    // A spawn the sender already encoded
+    struct EncodedSpawn
+    {
+        // Index in the appearance table, Appearances followed by AppearanceViews
+        uint32_t AppearanceId;
+        // Written with CharacterSpawnRequest::SerializeState
+        std::span<const uint8_t> State;
+        // Written with CharacterSpawnRequest::SerializeContent
+        std::span<const uint8_t> Content;
+    };
+
+    // Spawns are written as length prefixed blobs so pre-encoded ones can be copied as is
+    static constexpr size_t kMaxSpawnSize = 1 << 16;
+
+    // Characters of the same base form usually share their appearance, it is only sent once per batch
+    Vector<String> Appearances{};
+    // Only used when sending, lets the sender reference appearances it owns without copying them
+    Vector<std::string_view> AppearanceViews{};
+    // Filled with their appearance on reception
+    Vector<CharacterSpawnRequest> Spawns{};
+    // Only used when sending, written after Spawns and ignored by the comparison
+    Vector<EncodedSpawn> EncodedSpawns{};
+};
@@ -1,6 +1,22 @@
 #include <Messages/CharacterSpawnRequest.h>
 
 void CharacterSpawnRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    Serialization::WriteString(aWriter, AppearanceBuffer);
+    SerializeState(aWriter);
+    SerializeContent(aWriter);
+}
+
+void CharacterSpawnRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    ServerMessage::DeserializeRaw(aReader);
+
+    AppearanceBuffer = Serialization::ReadString(aReader);
+    DeserializeState(aReader);
+    DeserializeContent(aReader);
+}
+
+void CharacterSpawnRequest::SerializeState(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
     Serialization::WriteVarInt(aWriter, ServerId);
     FormId.Serialize(aWriter);
@@ -8,13 +24,7 @@ void CharacterSpawnRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     CellId.Serialize(aWriter);
     Position.Serialize(aWriter);
     Rotation.Serialize(aWriter);
-    aWriter.WriteBits(ChangeFlags, 32);
-    Serialization::WriteString(aWriter, AppearanceBuffer);
-    InventoryContent.Serialize(aWriter);
-    FactionsContent.Serialize(aWriter);
     LatestAction.GenerateDifferential(ActionEvent{}, aWriter);
-    FaceTints.Serialize(aWriter);
-    InitialActorValues.Serialize(aWriter);
     Serialization::WriteVarInt(aWriter, PlayerId);
     Serialization::WriteBool(aWriter, IsDead);
     Serialization::WriteBool(aWriter, IsPlayer);
@@ -22,10 +32,8 @@ void CharacterSpawnRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter)
     Serialization::WriteBool(aWriter, IsPlayerSummon);
 }
 
-void CharacterSpawnRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
+void CharacterSpawnRequest::DeserializeState(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
-    ServerMessage::DeserializeRaw(aReader);
-
     ServerId = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
     FormId.Deserialize(aReader);
     BaseId.Deserialize(aReader);
@@ -33,26 +41,38 @@ void CharacterSpawnRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReade
     Position.Deserialize(aReader);
     Rotation.Deserialize(aReader);
 
+    LatestAction = ActionEvent{};
+    LatestAction.ApplyDifferential(aReader);
+
+    PlayerId = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
+
+    IsDead = Serialization::ReadBool(aReader);
+    IsPlayer = Serialization::ReadBool(aReader);
+    IsWeaponDrawn = Serialization::ReadBool(aReader);
+    IsPlayerSummon = Serialization::ReadBool(aReader);
+}
+
+void CharacterSpawnRequest::SerializeContent(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    aWriter.WriteBits(ChangeFlags, 32);
+    InventoryContent.Serialize(aWriter);
+    FactionsContent.Serialize(aWriter);
+    FaceTints.Serialize(aWriter);
+    InitialActorValues.Serialize(aWriter);
+}
+
+void CharacterSpawnRequest::DeserializeContent(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
     uint64_t dest = 0;
     aReader.ReadBits(dest, 32);
     ChangeFlags = dest & 0xFFFFFFFF;
 
-    AppearanceBuffer = Serialization::ReadString(aReader);
     InventoryContent = {};
     InventoryContent.Deserialize(aReader);
 
     FactionsContent = {};
     FactionsContent.Deserialize(aReader);
 
-    LatestAction = ActionEvent{};
-    LatestAction.ApplyDifferential(aReader);
-
     FaceTints.Deserialize(aReader);
     InitialActorValues.Deserialize(aReader);
-    PlayerId = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
-
-    IsDead = Serialization::ReadBool(aReader);
-    IsPlayer = Serialization::ReadBool(aReader);
-    IsWeaponDrawn = Serialization::ReadBool(aReader);
-    IsPlayerSummon = Serialization::ReadBool(aReader);
 }
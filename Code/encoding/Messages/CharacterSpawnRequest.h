@@ -24,6 +24,13 @@ struct CharacterSpawnRequest final : ServerMessage
     void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
     void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
 
+    // Batched spawns share the appearance buffer between characters and send the rest in two parts,
+    // the content only changes with the character's looks, inventory, factions and actor values
+    void SerializeState(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    void DeserializeState(TiltedPhoques::Buffer::Reader& aReader) noexcept;
+    void SerializeContent(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    void DeserializeContent(TiltedPhoques::Buffer::Reader& aReader) noexcept;
+
     bool operator==(const CharacterSpawnRequest& acRhs) const noexcept
     {
         return ServerId == acRhs.ServerId && FormId == acRhs.FormId && BaseId == acRhs.BaseId && CellId == acRhs.CellId && Position == acRhs.Position && Rotation == acRhs.Rotation && ChangeFlags == acRhs.ChangeFlags && AppearanceBuffer == acRhs.AppearanceBuffer &&
@@ -2,39 +2,36 @@
 
 #include <Messages/ClientMessageFactory.h>
 
-static std::function<UniquePtr<ClientMessage>(TiltedPhoques::Buffer::Reader& aReader)> s_clientMessageExtractor[kClientOpcodeMax];
+namespace
+{
+using Extractor = UniquePtr<ClientMessage> (*)(TiltedPhoques::Buffer::Reader&);
 
-namespace details
+template <size_t I> UniquePtr<ClientMessage> ExtractMessage(TiltedPhoques::Buffer::Reader& aReader)
 {
-static struct ClientMessageFactoryInit
+    using T = ClientMessageFactory::Messages::At<I>;
+
+    auto ptr = TiltedPhoques::MakeUnique<T>();
+    ptr->DeserializeRaw(aReader);
+    return TiltedPhoques::CastUnique<ClientMessage>(std::move(ptr));
+}
+
+template <size_t... I> constexpr auto MakeExtractorTable(std::index_sequence<I...>) noexcept
 {
-    ClientMessageFactoryInit()
-    {
-        auto extractor = [](auto& x)
-        {
-            using T = typename std::remove_reference_t<decltype(x)>::Type;
-
-            s_clientMessageExtractor[T::Opcode] = [](TiltedPhoques::Buffer::Reader& aReader)
-            {
-                auto ptr = TiltedPhoques::MakeUnique<T>();
-                ptr->DeserializeRaw(aReader);
-                return TiltedPhoques::CastUnique<ClientMessage>(std::move(ptr));
-            };
-
-            return false;
-        };
-
-        ClientMessageFactory::Visit(extractor);
-    }
-} s_ClientMessageFactoryInit;
-} // namespace details
+    std::array<Extractor, kClientOpcodeMax> table{};
+    ((table[ClientMessageFactory::Messages::At<I>::Opcode] = &ExtractMessage<I>), ...);
+
+    return table;
+}
+
+constexpr auto s_clientMessageExtractor = MakeExtractorTable(std::make_index_sequence<ClientMessageFactory::Messages::Count>{});
+} // namespace
 
 UniquePtr<ClientMessage> ClientMessageFactory::Extract(TiltedPhoques::Buffer::Reader& aReader) const noexcept
 {
     uint64_t data;
     aReader.ReadBits(data, sizeof(ClientOpcode) * 8);
 
-    if (data >= kClientOpcodeMax) [[unlikely]]
+    if (data >= kClientOpcodeMax || !s_clientMessageExtractor[data]) [[unlikely]]
         return {nullptr};
 
     const auto opcode = static_cast<ClientOpcode>(data);
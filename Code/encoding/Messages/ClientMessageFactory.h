@@ -56,21 +56,78 @@
 #include <Messages/RequestSetWaypoint.h>
 #include <Messages/RequestRemoveWaypoint.h>
 
+#include <array>
+
 using TiltedPhoques::UniquePtr;
 
 struct ClientMessageFactory
 {
+    using Messages = MessageList<
+        AuthenticationRequest, AssignCharacterRequest, CancelAssignmentRequest, ClientReferencesMoveRequest, EnterInteriorCellRequest, RequestInventoryChanges, RequestFactionsChanges, RequestQuestUpdate, PartyInviteRequest, PartyAcceptInviteRequest, PartyLeaveRequest, PartyCreateRequest,
+        PartyChangeLeaderRequest, PartyKickRequest, RequestActorValueChanges, RequestActorMaxValueChanges, EnterExteriorCellRequest, RequestHealthChangeBroadcast, RequestSpawnData, ActivateRequest, LockChangeRequest, AssignObjectsRequest, RequestDeathStateChange, ShiftGridCellRequest,
+        RequestOwnershipTransfer, RequestOwnershipClaim, RequestObjectInventoryChanges, SpellCastRequest, ProjectileLaunchRequest, InterruptCastRequest, AddTargetRequest, ScriptAnimationRequest, DrawWeaponRequest, MountRequest, NewPackageRequest, RequestRespawn, SyncExperienceRequest,
+        RequestEquipmentChanges, SendChatMessageRequest, TeleportCommandRequest, PlayerRespawnRequest, DialogueRequest, SubtitleRequest, PlayerDialogueRequest, PlayerLevelRequest, TeleportRequest, RequestPlayerHealthUpdate, RequestWeatherChange, RequestCurrentWeather, RequestSetWaypoint,
+        RequestRemoveWaypoint>;
+
     UniquePtr<ClientMessage> Extract(TiltedPhoques::Buffer::Reader& aReader) const noexcept;
 
+    /**
+     * @brief Deserializes the next message into an instance owned by the factory and passes it to the visitor.
+     *
+     * Each opcode has a single instance that is reset and reused by every message of that type, so
+     * neither the message nor, in most cases, its containers allocate. The instance is only valid
+     * for the duration of the visitor call.
+     *
+     * @param aVisitor void(T&), called with the concrete message type.
+     * @return false if the opcode is unknown.
+     */
+    template <class TVisitor> bool Dispatch(TiltedPhoques::Buffer::Reader& aReader, TVisitor&& aVisitor) noexcept;
+
     template <class T> static auto Visit(T&& func)
     {
-        auto s_visitor = CreateMessageVisitor<
-            AuthenticationRequest, AssignCharacterRequest, CancelAssignmentRequest, ClientReferencesMoveRequest, EnterInteriorCellRequest, RequestInventoryChanges, RequestFactionsChanges, RequestQuestUpdate, PartyInviteRequest, PartyAcceptInviteRequest, PartyLeaveRequest, PartyCreateRequest,
-            PartyChangeLeaderRequest, PartyKickRequest, RequestActorValueChanges, RequestActorMaxValueChanges, EnterExteriorCellRequest, RequestHealthChangeBroadcast, RequestSpawnData, ActivateRequest, LockChangeRequest, AssignObjectsRequest, RequestDeathStateChange, ShiftGridCellRequest,
-            RequestOwnershipTransfer, RequestOwnershipClaim, RequestObjectInventoryChanges, SpellCastRequest, ProjectileLaunchRequest, InterruptCastRequest, AddTargetRequest, ScriptAnimationRequest, DrawWeaponRequest, MountRequest, NewPackageRequest, RequestRespawn, SyncExperienceRequest,
-            RequestEquipmentChanges, SendChatMessageRequest, TeleportCommandRequest, PlayerRespawnRequest, DialogueRequest, SubtitleRequest, PlayerDialogueRequest, PlayerLevelRequest, TeleportRequest, RequestPlayerHealthUpdate, RequestWeatherChange, RequestCurrentWeather, RequestSetWaypoint,
-            RequestRemoveWaypoint>;
-
-        return s_visitor(std::forward<T>(func));
+        return Messages::Visit(std::forward<T>(func));
     }
+
+private:
+    template <class TVisitor> using Handler = void (*)(Messages::Storage&, TiltedPhoques::Buffer::Reader&, TVisitor&);
+
+    template <size_t I, class TVisitor> static void DispatchMessage(Messages::Storage& aMessages, TiltedPhoques::Buffer::Reader& aReader, TVisitor& aVisitor)
+    {
+        using T = Messages::At<I>;
+
+        // Copy assigning an empty message resets it while its containers keep their storage
+        static const T s_empty{};
+
+        auto& message = std::get<I>(aMessages);
+        message = s_empty;
+        message.DeserializeRaw(aReader);
+
+        aVisitor(message);
+    }
+
+    template <class TVisitor, size_t... I> static constexpr auto MakeDispatchTable(std::index_sequence<I...>) noexcept
+    {
+        std::array<Handler<TVisitor>, kClientOpcodeMax> table{};
+        ((table[Messages::At<I>::Opcode] = &DispatchMessage<I, TVisitor>), ...);
+
+        return table;
+    }
+
+    Messages::Storage m_messages;
 };
+
+template <class TVisitor> bool ClientMessageFactory::Dispatch(TiltedPhoques::Buffer::Reader& aReader, TVisitor&& aVisitor) noexcept
+{
+    using Visitor = std::remove_reference_t<TVisitor>;
+
+    static constexpr auto s_handlers = MakeDispatchTable<Visitor>(std::make_index_sequence<Messages::Count>{});
+
+    uint64_t data;
+    aReader.ReadBits(data, sizeof(ClientOpcode) * 8);
+
+    if (data >= kClientOpcodeMax || !s_handlers[data]) [[unlikely]]
+        return false;
+
+    s_handlers[data](m_messages, aReader, aVisitor);
+    return true;
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Message.h"
+#include <Structs/ActorValues.h>
 
 struct NotifyActorMaxValueChanges final : ServerMessage
 {
@@ -17,5 +18,5 @@ struct NotifyActorMaxValueChanges final : ServerMessage
     bool operator==(const NotifyActorMaxValueChanges& acRhs) const noexcept { return Id == acRhs.Id && Values == acRhs.Values && GetOpcode() == acRhs.GetOpcode(); }
 
     uint32_t Id;
-    TiltedPhoques::Map<uint32_t, float> Values;
+    ActorValueBlock Values{};
 };
@@ -3,13 +3,7 @@
 void NotifyActorValueChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
     Serialization::WriteVarInt(aWriter, Id);
-
-    Serialization::WriteVarInt(aWriter, Values.size());
-    for (auto& value : Values)
-    {
-        Serialization::WriteVarInt(aWriter, value.first);
-        Serialization::WriteFloat(aWriter, value.second);
-    }
+    Values.Serialize(aWriter);
 }
 
 void NotifyActorValueChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
@@ -17,12 +11,5 @@ void NotifyActorValueChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aRea
     ServerMessage::DeserializeRaw(aReader);
 
     Id = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
-
-    const auto count = Serialization::ReadVarInt(aReader);
-    for (int i = 0; i < count; i++)
-    {
-        auto key = Serialization::ReadVarInt(aReader);
-        auto value = Serialization::ReadFloat(aReader);
-        Values.insert({key & 0xFFFFFFFF, value});
-    }
+    Values.Deserialize(aReader);
 }
@@ -0,0 +1,65 @@
+#include <Messages/NotifyMessageBundle.h>
+#include <Messages/ServerMessageFactory.h>
+#include <TiltedCore/Serialization.hpp>
+#include <TiltedCore/ViewBuffer.hpp>
+
+namespace
+{
+Buffer& GetMessageBuffer() noexcept
+{
+    static thread_local Buffer s_buffer(NotifyMessageBundle::kMaxBundleSize);
+    return s_buffer;
+}
+} // namespace
+
+void NotifyMessageBundle::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    Serialization::WriteVarInt(aWriter, Payloads.size());
+    for (const auto payload : Payloads)
+    {
+        Serialization::WriteVarInt(aWriter, payload.size());
+        aWriter.WriteBytes(payload.data(), payload.size());
+    }
+}
+
+void NotifyMessageBundle::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    ServerMessage::DeserializeRaw(aReader);
+
+    Messages.clear();
+
+    ServerMessageFactory factory;
+    auto& buffer = GetMessageBuffer();
+
+    const auto cCount = Serialization::ReadVarInt(aReader);
+    for (auto i = 0u; i < cCount; ++i)
+    {
+        const auto cSize = Serialization::ReadVarInt(aReader);
+
+        // Malformed packet, the following messages cannot be located
+        if (cSize > buffer.GetSize())
+            return;
+
+        aReader.ReadBytes(buffer.GetWriteData(), cSize);
+
+        TiltedPhoques::ViewBuffer view(buffer.GetWriteData(), cSize);
+
+        // Checked before extracting, a nested bundle would overwrite the buffer we are reading from
+        {
+            Buffer::Reader opcodeReader(&view);
+
+            uint64_t opcode = 0;
+            opcodeReader.ReadBits(opcode, sizeof(ServerOpcode) * 8);
+            if (opcode == Opcode)
+                continue;
+        }
+
+        Buffer::Reader messageReader(&view);
+
+        auto pMessage = factory.Extract(messageReader);
+        if (!pMessage)
+            continue;
+
+        Messages.push_back(std::move(pMessage));
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Message.h"
+
+#include <span>
+
+/**
+ * @brief Several server messages to the same recipient framed as a single packet.
+ *
+ * The server queues frequent notifications per recipient during a tick and flushes them as a bundle,
+ * the receiver dispatches the messages in the order they were queued. Bundles do not nest.
+ */
+struct NotifyMessageBundle final : ServerMessage
+{
+    static constexpr ServerOpcode Opcode = kNotifyMessageBundle;
+
+    // Bytes of framed messages per bundle, a message larger than this is sent on its own
+    static constexpr size_t kMaxBundleSize = 1 << 16;
+
+    NotifyMessageBundle()
+        : ServerMessage(Opcode)
+    {
+    }
+
+    void SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept override;
+    void DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept override;
+
+    bool operator==(const NotifyMessageBundle& acRhs) const noexcept { return Messages.size() == acRhs.Messages.size() && GetOpcode() == acRhs.GetOpcode(); }
+
+    // Only used when sending, messages already written with ServerMessage::Serialize
+    Vector<std::span<const uint8_t>> Payloads{};
+    // Filled on reception, messages that failed to parse are left out
+    Vector<TiltedPhoques::UniquePtr<ServerMessage>> Messages{};
+};
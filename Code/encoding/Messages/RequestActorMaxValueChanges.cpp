@@ -3,13 +3,7 @@
 void RequestActorMaxValueChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
     Serialization::WriteVarInt(aWriter, Id);
-
-    Serialization::WriteVarInt(aWriter, Values.size());
-    for (const auto& value : Values)
-    {
-        Serialization::WriteVarInt(aWriter, value.first);
-        Serialization::WriteFloat(aWriter, value.second);
-    }
+    Values.Serialize(aWriter);
 }
 
 void RequestActorMaxValueChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
@@ -17,12 +11,5 @@ void RequestActorMaxValueChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader&
     ClientMessage::DeserializeRaw(aReader);
 
     Id = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
-
-    auto count = Serialization::ReadVarInt(aReader);
-    for (decltype(count) i = 0; i < count; i++)
-    {
-        uint32_t key = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
-        auto value = Serialization::ReadFloat(aReader);
-        Values.insert({key, value});
-    }
+    Values.Deserialize(aReader);
 }
@@ -3,13 +3,7 @@
 void RequestActorValueChanges::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
     Serialization::WriteVarInt(aWriter, Id);
-
-    Serialization::WriteVarInt(aWriter, Values.size());
-    for (auto& value : Values)
-    {
-        Serialization::WriteVarInt(aWriter, value.first);
-        Serialization::WriteFloat(aWriter, value.second);
-    }
+    Values.Serialize(aWriter);
 }
 
 void RequestActorValueChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aReader) noexcept
@@ -17,12 +11,5 @@ void RequestActorValueChanges::DeserializeRaw(TiltedPhoques::Buffer::Reader& aRe
     ClientMessage::DeserializeRaw(aReader);
 
     Id = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
-
-    auto count = Serialization::ReadVarInt(aReader);
-    for (int i = 0; i < count; i++)
-    {
-        auto key = Serialization::ReadVarInt(aReader);
-        auto value = Serialization::ReadFloat(aReader);
-        Values.insert({key, value});
-    }
+    Values.Deserialize(aReader);
 }
@@ -1,15 +1,63 @@
 #include <Messages/ServerReferencesMoveRequest.h>
 #include <TiltedCore/Serialization.hpp>
 
+namespace
+{
+// Twice the largest update so an update that did not fit is detected instead of being sent truncated
+Buffer& GetUpdateBuffer() noexcept
+{
+    static thread_local Buffer s_buffer(ServerReferencesMoveRequest::kMaxUpdateSize * 2);
+    return s_buffer;
+}
+
+size_t SerializeUpdate(Buffer& aBuffer, const ReferenceDelta& acUpdate) noexcept
+{
+    Buffer::Writer updateWriter(&aBuffer);
+    acUpdate.Serialize(updateWriter);
+
+    return updateWriter.Size();
+}
+
+void WriteUpdate(TiltedPhoques::Buffer::Writer& aWriter, uint32_t aServerId, std::span<const uint8_t> aData) noexcept
+{
+    Serialization::WriteVarInt(aWriter, aServerId);
+    Serialization::WriteVarInt(aWriter, aData.size());
+    aWriter.WriteBytes(aData.data(), aData.size());
+}
+} // namespace
+
 void ServerReferencesMoveRequest::SerializeRaw(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
+    auto& buffer = GetUpdateBuffer();
+
+    // Updates larger than a receiver accepts are dropped, the count has to be known before they are written
+    size_t count = 0;
+    for (const auto& kvp : Updates)
+    {
+        if (SerializeUpdate(buffer, kvp.second) <= kMaxUpdateSize)
+            ++count;
+    }
+
+    for (const auto& update : EncodedUpdates)
+    {
+        if (update.Data.size() <= kMaxUpdateSize)
+            ++count;
+    }
+
     Serialization::WriteVarInt(aWriter, Tick);
-    Serialization::WriteVarInt(aWriter, Updates.size());
+    Serialization::WriteVarInt(aWriter, count);
 
     for (const auto& kvp : Updates)
     {
-        Serialization::WriteVarInt(aWriter, kvp.first);
-        kvp.second.Serialize(aWriter);
+        const auto cSize = SerializeUpdate(buffer, kvp.second);
+        if (cSize <= kMaxUpdateSize)
+            WriteUpdate(aWriter, kvp.first, {buffer.GetWriteData(), cSize});
+    }
+
+    for (const auto& update : EncodedUpdates)
+    {
+        if (update.Data.size() <= kMaxUpdateSize)
+            WriteUpdate(aWriter, update.ServerId, update.Data);
     }
 }
 
@@ -20,9 +68,20 @@ void ServerReferencesMoveRequest::DeserializeRaw(TiltedPhoques::Buffer::Reader&
     Tick = Serialization::ReadVarInt(aReader);
     const auto count = Serialization::ReadVarInt(aReader);
 
+    auto& buffer = GetUpdateBuffer();
+
     for (auto i = 0u; i < count; ++i)
     {
         const uint32_t cServerId = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
-        Updates[cServerId].Deserialize(aReader);
+        const auto cSize = Serialization::ReadVarInt(aReader);
+
+        // Malformed packet, the rest of the updates cannot be located
+        if (cSize > kMaxUpdateSize)
+            return;
+
+        aReader.ReadBytes(buffer.GetWriteData(), cSize);
+
+        Buffer::Reader updateReader(&buffer);
+        Updates[cServerId].Deserialize(updateReader);
     }
 }
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "Message.h"
-#include <Structs/ReferenceUpdate.h>
+#include <Structs/ReferenceDelta.h>
+
+#include <span>
 
 using TiltedPhoques::String;
 
@@ -19,6 +21,19 @@ struct ServerReferencesMoveRequest final : ServerMessage
 
     bool operator==(const ServerReferencesMoveRequest& acRhs) const noexcept { return Updates == acRhs.Updates && Tick == acRhs.Tick && GetOpcode() == acRhs.GetOpcode(); }
 
+    // An update the sender already encoded with ReferenceDelta::Serialize
+    struct EncodedUpdate
+    {
+        uint32_t ServerId;
+        std::span<const uint8_t> Data;
+    };
+
+    // Updates are written as length prefixed blobs so pre-encoded ones can be copied as is
+    static constexpr size_t kMaxUpdateSize = 1 << 16;
+
     uint64_t Tick{};
-    TiltedPhoques::Map<uint32_t, ReferenceUpdate> Updates{};
+    // Movements are encoded against the last update the recipient got for the same reference
+    TiltedPhoques::Map<uint32_t, ReferenceDelta> Updates{};
+    // Only used when sending, written after Updates and ignored by the comparison
+    Vector<EncodedUpdate> EncodedUpdates{};
 };
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <tuple>
+
 namespace details
 {
 template <class T> struct MetaMessage
@@ -19,3 +21,21 @@ auto CreateMessageVisitor = [](auto&& f) mutable
 
     expender(::details::MetaMessage<T>{}...);
 };
+
+/**
+ * Type list of the messages a factory can produce.
+ */
+template <class... T> struct MessageList
+{
+    static constexpr size_t Count = sizeof...(T);
+
+    using Storage = std::tuple<T...>;
+    template <size_t I> using At = std::tuple_element_t<I, Storage>;
+
+    template <class TFunc> static auto Visit(TFunc&& func)
+    {
+        auto s_visitor = CreateMessageVisitor<T...>;
+
+        return s_visitor(std::forward<TFunc>(func));
+    }
+};
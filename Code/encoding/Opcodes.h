@@ -112,5 +112,7 @@ enum ServerOpcode : unsigned char
     kNotifyWeatherChange,
     kNotifySetWaypoint,
     kNotifyRemoveWaypoint,
+    kCharacterSpawnBatchRequest,
+    kNotifyMessageBundle,
     kServerOpcodeMax
 };
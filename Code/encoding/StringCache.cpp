@@ -1,14 +1,17 @@
 #include <StringCache.h>
 #include <iostream>
 
-bool StringCache::Contains(const TiltedPhoques::String& acValue) const noexcept
+bool StringCache::Contains(std::string_view aValue) const noexcept
 {
-    return m_stringToId.contains(acValue);
+    return this->operator[](aValue).has_value();
 }
 
-std::optional<uint32_t> StringCache::operator[](const TiltedPhoques::String& acValue) const noexcept
+std::optional<uint32_t> StringCache::operator[](std::string_view aValue) const noexcept
 {
-    if (const auto itor = m_stringToId.find(acValue); itor != std::end(m_stringToId))
+    auto& shard = GetShard(aValue);
+    std::shared_lock _(shard.Lock);
+
+    if (const auto itor = shard.Ids.find(aValue); itor != std::end(shard.Ids))
         return itor->second;
 
     return std::nullopt;
@@ -16,32 +19,65 @@ std::optional<uint32_t> StringCache::operator[](const TiltedPhoques::String& acV
 
 std::optional<const TiltedPhoques::String> StringCache::operator[](uint32_t aValue) const noexcept
 {
-    if (aValue < m_idToString.size())
-        return m_idToString[aValue];
+    if (const auto* pValue = Find(aValue))
+        return *pValue;
 
     return std::nullopt;
 }
 
+const TiltedPhoques::String* StringCache::Find(uint32_t aValue) const noexcept
+{
+    // The slot and its page are written before the size is published
+    if (aValue < m_size.load(std::memory_order_acquire))
+        return &m_pages[aValue / kPageSize]->Values[aValue % kPageSize];
+
+    return nullptr;
+}
+
 uint32_t StringCache::Add(const TiltedPhoques::String& acValue) noexcept
 {
-    if (auto id = this->operator[](acValue))
-        return *id;
+    auto& shard = GetShard(acValue);
+    std::unique_lock shardLock(shard.Lock);
+
+    if (const auto itor = shard.Ids.find(acValue); itor != std::end(shard.Ids))
+        return itor->second;
+
+    // Ids must be published in order, appending is serialized across shards
+    std::unique_lock appendLock(m_appendLock);
 
-    const auto allocatedId = m_idToString.size();
-    m_stringToId[acValue] = allocatedId & 0xFFFFFFFF;
-    m_idToString.push_back(acValue);
+    const auto allocatedId = m_size.load(std::memory_order_relaxed);
+    if (allocatedId >= kCapacity)
+        return kInvalidId;
+
+    auto& pPage = m_pages[allocatedId / kPageSize];
+    if (!pPage)
+    {
+        TiltedPhoques::ScopedAllocator _{TiltedPhoques::Allocator::GetDefault()};
+        pPage = TiltedPhoques::MakeUnique<Page>();
+    }
+
+    auto& value = pPage->Values[allocatedId % kPageSize];
+    value = acValue;
+
+    m_size.store(allocatedId + 1, std::memory_order_release);
+    appendLock.unlock();
+
+    shard.Ids[std::string_view(value)] = allocatedId;
 
     return allocatedId;
 }
 
-void StringCache::AddWanted(const TiltedPhoques::String& acValue) noexcept
+void StringCache::AddWanted(const TiltedPhoques::String& acValue) const noexcept
 {
-    m_wantedStrings.insert(acValue);
+    auto& shard = GetShard(acValue);
+    std::unique_lock _(shard.Lock);
+
+    shard.Wanted.insert(acValue);
 }
 
 size_t StringCache::Size() const noexcept
 {
-    return m_idToString.size();
+    return m_size.load(std::memory_order_acquire);
 }
 
 StringCacheUpdate StringCache::Serialize(uint32_t& aStartId) const noexcept
@@ -49,14 +85,15 @@ StringCacheUpdate StringCache::Serialize(uint32_t& aStartId) const noexcept
     StringCacheUpdate update;
     update.StartId = aStartId;
 
-    if (aStartId < m_idToString.size())
+    const auto cSize = m_size.load(std::memory_order_acquire);
+    if (aStartId < cSize)
     {
-        auto itor = std::begin(m_idToString);
-        std::advance(itor, aStartId);
+        update.Values.reserve(cSize - aStartId);
 
-        update.Values.insert(std::begin(update.Values), itor, std::end(m_idToString));
+        for (auto id = aStartId; id < cSize; ++id)
+            update.Values.push_back(m_pages[id / kPageSize]->Values[id % kPageSize]);
 
-        aStartId = m_idToString.size();
+        aStartId = cSize;
     }
 
     return update;
@@ -65,11 +102,11 @@ StringCacheUpdate StringCache::Serialize(uint32_t& aStartId) const noexcept
 void StringCache::Deserialize(const StringCacheUpdate& aMessage) noexcept
 {
     // We should only receive contiguous updates
-    assert(aMessage.StartId == m_idToString.size());
+    assert(aMessage.StartId == Size());
 
     for (auto& value : aMessage.Values)
     {
-        const auto expectedId = m_idToString.size();
+        const auto expectedId = Size();
         auto id = Add(value);
 
         assert(id == expectedId);
@@ -78,36 +115,66 @@ void StringCache::Deserialize(const StringCacheUpdate& aMessage) noexcept
 
 void StringCache::Clear() noexcept
 {
-    m_idToString.clear();
-    m_wantedStrings.clear();
-    m_stringToId.clear();
+    for (auto& shard : m_shards)
+    {
+        std::unique_lock _(shard.Lock);
+
+        shard.Ids.clear();
+        shard.Wanted.clear();
+    }
+
+    // Slots are overwritten as ids get allocated again, the pages are kept around
+    m_size.store(0, std::memory_order_release);
+    m_generation.fetch_add(1, std::memory_order_acq_rel);
 }
 
 bool StringCache::ProcessDirty() noexcept
 {
-    if (m_wantedStrings.empty())
-        return false;
+    const auto cStartSize = Size();
 
-    for (auto& s : m_wantedStrings)
-        Add(s);
-
-    ClearDirty();
+    for (auto& shard : m_shards)
+    {
+        TiltedPhoques::Set<TiltedPhoques::String> wanted;
+        {
+            std::unique_lock _(shard.Lock);
+            wanted = std::move(shard.Wanted);
+            shard.Wanted.clear();
+        }
+
+        for (auto& s : wanted)
+            Add(s);
+    }
 
-    return true;
+    return Size() != cStartSize;
 }
 
 void StringCache::ClearDirty() noexcept
 {
-    m_wantedStrings.clear();
+    for (auto& shard : m_shards)
+    {
+        std::unique_lock _(shard.Lock);
+        shard.Wanted.clear();
+    }
+}
+
+StringCache::Shard& StringCache::GetShard(std::string_view aValue) const noexcept
+{
+    // The maps hash with the low bits, pick the shard with the high ones
+    const auto cHash = std::hash<std::string_view>{}(aValue);
+    return m_shards[(cHash >> (sizeof(size_t) * 8 - 4)) % kShardCount];
 }
 
 StringCache& StringCache::Get() noexcept
 {
-    TiltedPhoques::ScopedAllocator _{TiltedPhoques::Allocator::GetDefault()};
+    // The containers capture the allocator in scope when they are built, only the first call needs to set it up
+    static StringCache& s_instance = []() -> StringCache&
     {
-        static StringCache s_instance;
-        return s_instance;
-    }
+        TiltedPhoques::ScopedAllocator _{TiltedPhoques::Allocator::GetDefault()};
+        static StringCache s_cache;
+        return s_cache;
+    }();
+
+    return s_instance;
 }
 
 StringCache::StringCache()
@@ -2,29 +2,70 @@
 
 #include <Messages/StringCacheUpdate.h>
 
+#include <array>
+#include <atomic>
+#include <shared_mutex>
+
+/**
+ * @brief Process wide string interning, safe to use from any thread.
+ *
+ * Ids index an append-only log whose slots never move, resolving an id is lock free and the
+ * returned strings stay valid until Clear(). String to id lookups go through a set of shards so
+ * concurrent encoders rarely wait on each other. Clear() must not race with any other call.
+ */
 struct StringCache
 {
     TP_NOCOPYMOVE(StringCache);
 
-    [[nodiscard]] bool Contains(const TiltedPhoques::String&) const noexcept;
+    // Returned by lookups that did not resolve, lets callers store ids without an optional
+    static constexpr uint32_t kInvalidId = 0xFFFFFFFF;
+    // StringCacheUpdate carries 16 bit ids
+    static constexpr uint32_t kCapacity = 1 << 16;
+
+    [[nodiscard]] bool Contains(std::string_view) const noexcept;
 
-    [[nodiscard]] std::optional<uint32_t> operator[](const TiltedPhoques::String&) const noexcept;
+    [[nodiscard]] std::optional<uint32_t> operator[](std::string_view) const noexcept;
     [[nodiscard]] std::optional<const TiltedPhoques::String> operator[](uint32_t) const noexcept;
+    [[nodiscard]] const TiltedPhoques::String* Find(uint32_t) const noexcept;
+    // Returns kInvalidId once the cache is full
     uint32_t Add(const TiltedPhoques::String&) noexcept;
-    [[nodiscard]] void AddWanted(const TiltedPhoques::String&) noexcept;
+    void AddWanted(const TiltedPhoques::String&) const noexcept;
     [[nodiscard]] size_t Size() const noexcept;
+    // Bumped by Clear(), ids resolved under an older generation must be looked up again
+    [[nodiscard]] uint32_t GetGeneration() const noexcept { return m_generation.load(std::memory_order_acquire); }
     [[nodiscard]] StringCacheUpdate Serialize(uint32_t& aStartId) const noexcept;
-    [[nodiscard]] void Deserialize(const StringCacheUpdate& aMessage) noexcept;
+    void Deserialize(const StringCacheUpdate& aMessage) noexcept;
     void Clear() noexcept;
+    // Interns the wanted strings, returns true if any id was allocated
     bool ProcessDirty() noexcept;
     void ClearDirty() noexcept;
 
     static StringCache& Get() noexcept;
 
 private:
-    TiltedPhoques::Vector<TiltedPhoques::String> m_idToString;
-    mutable TiltedPhoques::Set<TiltedPhoques::String> m_wantedStrings;
-    TiltedPhoques::Map<TiltedPhoques::String, uint32_t> m_stringToId;
+    static constexpr uint32_t kPageSize = 256;
+    static constexpr uint32_t kShardCount = 16;
+
+    struct Page
+    {
+        TiltedPhoques::String Values[kPageSize];
+    };
+
+    struct Shard
+    {
+        std::shared_mutex Lock;
+        // Keys point into the log
+        TiltedPhoques::Map<std::string_view, uint32_t> Ids;
+        TiltedPhoques::Set<TiltedPhoques::String> Wanted;
+    };
+
+    [[nodiscard]] Shard& GetShard(std::string_view aValue) const noexcept;
+
+    std::array<TiltedPhoques::UniquePtr<Page>, kCapacity / kPageSize> m_pages;
+    std::atomic<uint32_t> m_size{0};
+    std::mutex m_appendLock;
+    mutable std::array<Shard, kShardCount> m_shards;
+    std::atomic<uint32_t> m_generation{0};
 
     StringCache();
 };
@@ -1,50 +1,164 @@
 #include <Structs/ActorValues.h>
 #include <TiltedCore/Serialization.hpp>
 
+#include <bit>
+
 using TiltedPhoques::Serialization;
 
-bool ActorValues::operator==(const ActorValues& acRhs) const noexcept
+ActorValueBlock::Iterator& ActorValueBlock::Iterator::operator++() noexcept
 {
-    return ActorValuesList == acRhs.ActorValuesList;
+    Id = pBlock->NextSet(Id + 1);
+    return *this;
 }
 
-bool ActorValues::operator!=(const ActorValues& acRhs) const noexcept
+bool ActorValueBlock::operator==(const ActorValueBlock& acRhs) const noexcept
+{
+    if (m_set != acRhs.m_set)
+        return false;
+
+    for (auto id = NextSet(0); id < kMaxValues; id = NextSet(id + 1))
+    {
+        if (m_values[id] != acRhs.m_values[id])
+            return false;
+    }
+
+    return true;
+}
+
+bool ActorValueBlock::operator!=(const ActorValueBlock& acRhs) const noexcept
 {
     return !this->operator==(acRhs);
 }
 
-void ActorValues::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+bool ActorValueBlock::Contains(uint32_t aId) const noexcept
+{
+    return aId < kMaxValues && (m_set[aId / 64] & (uint64_t(1) << (aId % 64))) != 0;
+}
+
+float ActorValueBlock::Get(uint32_t aId) const noexcept
+{
+    return Contains(aId) ? m_values[aId] : 0.f;
+}
+
+void ActorValueBlock::Set(uint32_t aId, float aValue) noexcept
 {
-    Serialization::WriteVarInt(aWriter, ActorValuesList.size());
-    for (auto& value : ActorValuesList)
+    if (aId >= kMaxValues)
+        return;
+
+    m_values[aId] = aValue;
+    m_set[aId / 64] |= uint64_t(1) << (aId % 64);
+}
+
+size_t ActorValueBlock::Size() const noexcept
+{
+    size_t count = 0;
+    for (const auto cWord : m_set)
+        count += std::popcount(cWord);
+
+    return count;
+}
+
+bool ActorValueBlock::Empty() const noexcept
+{
+    return m_set == decltype(m_set){};
+}
+
+void ActorValueBlock::Merge(const ActorValueBlock& acChanges) noexcept
+{
+    for (uint32_t i = 0; i < kMaxValues; ++i)
     {
-        Serialization::WriteVarInt(aWriter, value.first);
-        Serialization::WriteFloat(aWriter, value.second);
+        if (acChanges.Contains(i))
+            m_values[i] = acChanges.m_values[i];
     }
 
-    Serialization::WriteVarInt(aWriter, ActorMaxValuesList.size());
-    for (auto& value : ActorMaxValuesList)
+    for (uint32_t i = 0; i < kMaskWords; ++i)
     {
-        Serialization::WriteVarInt(aWriter, value.first);
-        Serialization::WriteFloat(aWriter, value.second);
+        m_set[i] |= acChanges.m_set[i];
+        m_dirty[i] |= acChanges.m_set[i];
     }
 }
 
-void ActorValues::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
+bool ActorValueBlock::IsDirty() const noexcept
 {
-    auto count = Serialization::ReadVarInt(aReader);
-    for (int i = 0; i < count; i++)
-    {
-        auto key = Serialization::ReadVarInt(aReader);
-        auto value = Serialization::ReadFloat(aReader);
-        ActorValuesList.insert({key, value});
-    }
+    return m_dirty != decltype(m_dirty){};
+}
+
+ActorValueBlock ActorValueBlock::TakeDirty() noexcept
+{
+    ActorValueBlock changes;
+    changes.m_values = m_values;
+    changes.m_set = m_dirty;
+
+    m_dirty = {};
 
-    auto maxCount = Serialization::ReadVarInt(aReader);
-    for (int i = 0; i < maxCount; i++)
+    return changes;
+}
+
+void ActorValueBlock::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    // Trailing empty words are not written, most blocks only use the low ids
+    uint32_t wordCount = kMaskWords;
+    while (wordCount > 0 && m_set[wordCount - 1] == 0)
+        --wordCount;
+
+    Serialization::WriteVarInt(aWriter, wordCount);
+    for (uint32_t i = 0; i < wordCount; ++i)
+        Serialization::WriteVarInt(aWriter, m_set[i]);
+
+    for (const auto [id, value] : *this)
+        Serialization::WriteFloat(aWriter, value);
+}
+
+void ActorValueBlock::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    *this = {};
+
+    const auto cWordCount = Serialization::ReadVarInt(aReader);
+
+    // Serialize never writes more words than the mask has, anything else is a malformed packet and is left empty
+    if (cWordCount > kMaskWords)
+        return;
+
+    for (uint64_t i = 0; i < cWordCount; ++i)
+        m_set[i] = Serialization::ReadVarInt(aReader);
+
+    for (auto id = NextSet(0); id < kMaxValues; id = NextSet(id + 1))
+        m_values[id] = Serialization::ReadFloat(aReader);
+}
+
+uint32_t ActorValueBlock::NextSet(uint32_t aId) const noexcept
+{
+    for (auto word = aId / 64; word < kMaskWords; ++word)
     {
-        auto key = Serialization::ReadVarInt(aReader);
-        auto value = Serialization::ReadFloat(aReader);
-        ActorMaxValuesList.insert({key, value});
+        auto bits = m_set[word];
+        if (word == aId / 64)
+            bits &= ~uint64_t(0) << (aId % 64);
+
+        if (bits != 0)
+            return word * 64 + std::countr_zero(bits);
     }
+
+    return kMaxValues;
+}
+
+bool ActorValues::operator==(const ActorValues& acRhs) const noexcept
+{
+    return ActorValuesList == acRhs.ActorValuesList;
+}
+
+bool ActorValues::operator!=(const ActorValues& acRhs) const noexcept
+{
+    return !this->operator==(acRhs);
+}
+
+void ActorValues::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    ActorValuesList.Serialize(aWriter);
+    ActorMaxValuesList.Serialize(aWriter);
+}
+
+void ActorValues::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    ActorValuesList.Deserialize(aReader);
+    ActorMaxValuesList.Deserialize(aReader);
 }
@@ -1,5 +1,67 @@
 #pragma once
 
+#include <array>
+
+/**
+ * @brief Actor values stored by id in a fixed size block.
+ *
+ * Actor value ids are small and dense, values live in a flat array and a bitmask tells which ones are set.
+ * Only set values are serialized, a block holding a handful of changes doubles as a compact delta.
+ * A second mask tracks values merged since they were last taken, the server uses it to coalesce changes.
+ */
+struct ActorValueBlock
+{
+    // Skyrim has 164 actor values, Fallout 4 has 132
+    static constexpr uint32_t kMaxValues = 192;
+    static constexpr uint32_t kMaskWords = kMaxValues / 64;
+
+    struct Iterator
+    {
+        std::pair<uint32_t, float> operator*() const noexcept { return {Id, pBlock->m_values[Id]}; }
+        Iterator& operator++() noexcept;
+
+        bool operator==(const Iterator& acRhs) const noexcept { return Id == acRhs.Id; }
+        bool operator!=(const Iterator& acRhs) const noexcept { return Id != acRhs.Id; }
+
+        const ActorValueBlock* pBlock;
+        uint32_t Id;
+    };
+
+    bool operator==(const ActorValueBlock& acRhs) const noexcept;
+    bool operator!=(const ActorValueBlock& acRhs) const noexcept;
+
+    [[nodiscard]] bool Contains(uint32_t aId) const noexcept;
+    // Returns 0 for values that are not set
+    [[nodiscard]] float Get(uint32_t aId) const noexcept;
+    // Ids past kMaxValues are ignored
+    void Set(uint32_t aId, float aValue) noexcept;
+    [[nodiscard]] size_t Size() const noexcept;
+    [[nodiscard]] bool Empty() const noexcept;
+
+    /**
+     * @brief Sets every value of acChanges and marks them dirty.
+     */
+    void Merge(const ActorValueBlock& acChanges) noexcept;
+    [[nodiscard]] bool IsDirty() const noexcept;
+    /**
+     * @brief Returns the values marked dirty and clears the marks.
+     */
+    [[nodiscard]] ActorValueBlock TakeDirty() noexcept;
+
+    [[nodiscard]] Iterator begin() const noexcept { return {this, NextSet(0)}; }
+    [[nodiscard]] Iterator end() const noexcept { return {this, kMaxValues}; }
+
+    void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
+
+private:
+    [[nodiscard]] uint32_t NextSet(uint32_t aId) const noexcept;
+
+    alignas(16) std::array<float, kMaxValues> m_values{};
+    std::array<uint64_t, kMaskWords> m_set{};
+    std::array<uint64_t, kMaskWords> m_dirty{};
+};
+
 struct ActorValues
 {
     ActorValues() = default;
@@ -11,6 +73,6 @@ struct ActorValues
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
 
-    TiltedPhoques::Map<uint32_t, float> ActorValuesList{};
-    TiltedPhoques::Map<uint32_t, float> ActorMaxValuesList{};
+    ActorValueBlock ActorValuesList{};
+    ActorValueBlock ActorMaxValuesList{};
 };
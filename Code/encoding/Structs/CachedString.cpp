@@ -7,36 +7,47 @@ using TiltedPhoques::Serialization;
 CachedString& CachedString::operator=(const TiltedPhoques::String& acRhs) noexcept
 {
     String::operator=(acRhs);
+    Resolve();
+
     return *this;
 }
 
 void CachedString::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
 {
-    const auto cId = StringCache::Get()[*this];
+    auto& cache = StringCache::Get();
+
+    std::optional<uint32_t> id;
+    if (m_id != StringCache::kInvalidId && m_generation == cache.GetGeneration())
+        id = m_id;
+    else
+        id = cache[*this]; // Not interned when assigned, it may have been since
 
-    Serialization::WriteBool(aWriter, cId.has_value());
-    if (cId)
+    Serialization::WriteBool(aWriter, id.has_value());
+    if (id)
     {
-        Serialization::WriteVarInt(aWriter, *cId);
+        Serialization::WriteVarInt(aWriter, *id);
     }
     else
     {
         Serialization::WriteString(aWriter, *this);
 
-        StringCache::Get().AddWanted(*this);
+        cache.AddWanted(*this);
     }
 }
 
 void CachedString::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
 {
+    auto& cache = StringCache::Get();
+
     const auto cHasId = Serialization::ReadBool(aReader);
     if (cHasId)
     {
         const auto cId = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
-        const auto cValue = StringCache::Get()[cId];
-        if (cValue)
+        if (const auto* pValue = cache.Find(cId))
         {
-            *this = *cValue;
+            String::operator=(*pValue);
+            m_id = cId;
+            m_generation = cache.GetGeneration();
         }
         else
         {
@@ -48,6 +59,16 @@ void CachedString::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
     {
         *this = Serialization::ReadString(aReader);
 
-        StringCache::Get().AddWanted(*this);
+        // The sender may just not know about it yet
+        if (m_id == StringCache::kInvalidId)
+            cache.AddWanted(*this);
     }
 }
+
+void CachedString::Resolve() noexcept
+{
+    auto& cache = StringCache::Get();
+
+    m_id = cache[*this].value_or(StringCache::kInvalidId);
+    m_generation = cache.GetGeneration();
+}
@@ -1,5 +1,12 @@
 #pragma once
 
+/**
+ * @brief String shared through the StringCache, sent as an id once both ends know it.
+ *
+ * The id is resolved when the string is assigned and kept alongside it, serializing a known string
+ * is a single varint write. Only assign through operator=, mutating the String in place would leave
+ * a stale id behind.
+ */
 struct CachedString : TiltedPhoques::String
 {
     CachedString() = default;
@@ -9,4 +16,10 @@ struct CachedString : TiltedPhoques::String
 
     void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
     void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
+
+private:
+    void Resolve() noexcept;
+
+    uint32_t m_id{0xFFFFFFFF};
+    uint32_t m_generation{0};
 };
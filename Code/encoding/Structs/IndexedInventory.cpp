@@ -0,0 +1,143 @@
+#include <Structs/IndexedInventory.h>
+
+#include <bit>
+
+IndexedInventory& IndexedInventory::operator=(const Inventory& acInventory) noexcept
+{
+    m_inventory = acInventory;
+    Rebuild();
+
+    return *this;
+}
+
+int32_t IndexedInventory::GetEntryCountById(const GameId& acItemId) const noexcept
+{
+    auto itor = m_buckets.find(acItemId);
+    if (itor == std::end(m_buckets))
+        return 0;
+
+    return m_inventory.Entries[itor->second.front()].Count;
+}
+
+void IndexedInventory::AddOrRemoveEntry(const Inventory::Entry& acEntry) noexcept
+{
+    auto& bucket = m_buckets[acEntry.BaseId];
+    for (const auto cIndex : bucket)
+    {
+        auto& entry = m_inventory.Entries[cIndex];
+        if (!entry.IsExtraDataEquals(acEntry))
+            continue;
+
+        entry.Count += acEntry.Count;
+        if (entry.Count <= 0)
+            RemoveAt(cIndex);
+
+        return;
+    }
+
+    const auto cIndex = static_cast<uint32_t>(m_inventory.Entries.size());
+
+    bucket.push_back(cIndex);
+    m_inventory.Entries.push_back(acEntry);
+    SetWorn(cIndex, acEntry.IsWorn());
+}
+
+void IndexedInventory::UpdateEquipment(const Inventory& acNewInventory) noexcept
+{
+    for (size_t word = 0; word < m_worn.size(); ++word)
+    {
+        for (auto bits = m_worn[word]; bits != 0; bits &= bits - 1)
+        {
+            auto& entry = m_inventory.Entries[word * 64 + std::countr_zero(bits)];
+            entry.ExtraWorn = entry.ExtraWornLeft = false;
+        }
+
+        m_worn[word] = 0;
+    }
+
+    for (const auto& newEntry : acNewInventory.Entries)
+    {
+        if (!newEntry.IsWorn())
+            continue;
+
+        auto itor = m_buckets.find(newEntry.BaseId);
+
+        // This shouldn't happen
+        if (itor == std::end(m_buckets))
+            continue;
+
+        const auto cIndex = itor->second.front();
+        auto& entry = m_inventory.Entries[cIndex];
+
+        entry.ExtraWorn = newEntry.ExtraWorn;
+        entry.ExtraWornLeft = newEntry.ExtraWornLeft;
+        SetWorn(cIndex, true);
+    }
+
+    m_inventory.CurrentMagicEquipment = acNewInventory.CurrentMagicEquipment;
+}
+
+void IndexedInventory::Rebuild() noexcept
+{
+    m_buckets.clear();
+    m_worn.clear();
+
+    for (uint32_t i = 0; i < m_inventory.Entries.size(); ++i)
+    {
+        const auto& entry = m_inventory.Entries[i];
+
+        m_buckets[entry.BaseId].push_back(i);
+        SetWorn(i, entry.IsWorn());
+    }
+}
+
+void IndexedInventory::RemoveAt(uint32_t aIndex) noexcept
+{
+    auto& entries = m_inventory.Entries;
+    const auto cLast = static_cast<uint32_t>(entries.size() - 1);
+
+    auto itor = m_buckets.find(entries[aIndex].BaseId);
+    auto& bucket = itor.value();
+    bucket.erase(std::find(std::begin(bucket), std::end(bucket), aIndex));
+    if (bucket.empty())
+        m_buckets.erase(itor);
+
+    if (aIndex != cLast)
+    {
+        entries[aIndex] = std::move(entries[cLast]);
+
+        auto& movedBucket = m_buckets.find(entries[aIndex].BaseId).value();
+        *std::find(std::begin(movedBucket), std::end(movedBucket), cLast) = aIndex;
+
+        SetWorn(aIndex, IsWorn(cLast));
+    }
+
+    SetWorn(cLast, false);
+    entries.pop_back();
+}
+
+void IndexedInventory::SetWorn(uint32_t aIndex, bool aWorn) noexcept
+{
+    const auto cWord = aIndex / 64;
+    const auto cBit = uint64_t(1) << (aIndex % 64);
+
+    if (cWord >= m_worn.size())
+    {
+        if (!aWorn)
+            return;
+
+        m_worn.resize(cWord + 1, 0);
+    }
+
+    if (aWorn)
+        m_worn[cWord] |= cBit;
+    else
+        m_worn[cWord] &= ~cBit;
+}
+
+bool IndexedInventory::IsWorn(uint32_t aIndex) const noexcept
+{
+    const auto cWord = aIndex / 64;
+
+    return cWord < m_worn.size() && (m_worn[cWord] & (uint64_t(1) << (aIndex % 64))) != 0;
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Inventory.h"
+
+/**
+ * @brief Inventory indexed for the server, where large containers receive a change per item moved.
+ *
+ * Entries are bucketed by base id, entries of the same item that differ in extra data share a bucket.
+ * Worn entries are kept in a bitmap over entry indices so equipment updates only touch what is worn.
+ * Removing an entry moves the last one into its place, entry order is not preserved.
+ */
+struct IndexedInventory
+{
+    IndexedInventory() = default;
+    ~IndexedInventory() = default;
+
+    IndexedInventory& operator=(const Inventory& acInventory) noexcept;
+
+    [[nodiscard]] const Inventory& GetInventory() const noexcept { return m_inventory; }
+    [[nodiscard]] int32_t GetEntryCountById(const GameId& acItemId) const noexcept;
+
+    void AddOrRemoveEntry(const Inventory::Entry& acEntry) noexcept;
+    void UpdateEquipment(const Inventory& acNewInventory) noexcept;
+
+private:
+    void Rebuild() noexcept;
+    void RemoveAt(uint32_t aIndex) noexcept;
+    void SetWorn(uint32_t aIndex, bool aWorn) noexcept;
+    [[nodiscard]] bool IsWorn(uint32_t aIndex) const noexcept;
+
+    Inventory m_inventory{};
+    // Indices in m_inventory.Entries, in insertion order
+    TiltedPhoques::Map<GameId, Vector<uint32_t>> m_buckets{};
+    Vector<uint64_t> m_worn{};
+};
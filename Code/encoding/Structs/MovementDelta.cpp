@@ -0,0 +1,319 @@
+#include <Structs/MovementDelta.h>
+#include <TiltedCore/Serialization.hpp>
+
+using TiltedPhoques::Serialization;
+
+namespace
+{
+// The change mask of the variables is 64 bits wide, one bit is taken by the booleans
+constexpr size_t cMaxVariableCount = 63;
+
+uint64_t ZigZagEncode(int32_t aValue) noexcept
+{
+    return (static_cast<uint32_t>(aValue) << 1) ^ static_cast<uint32_t>(aValue >> 31);
+}
+
+int32_t ZigZagDecode(uint64_t aValue) noexcept
+{
+    const auto cValue = static_cast<uint32_t>(aValue & 0xFFFFFFFF);
+    return static_cast<int32_t>((cValue >> 1) ^ (~(cValue & 1) + 1));
+}
+
+glm::ivec3 Quantize(const Vector3_NetQuantize& acPosition) noexcept
+{
+    return {static_cast<int32_t>(acPosition.x), static_cast<int32_t>(acPosition.y), static_cast<int32_t>(acPosition.z)};
+}
+
+uint32_t FloatBits(float aValue) noexcept
+{
+    return *reinterpret_cast<const uint32_t*>(&aValue);
+}
+
+float BitsFloat(uint64_t aValue) noexcept
+{
+    uint32_t bits = aValue & 0xFFFFFFFF;
+    return *reinterpret_cast<float*>(&bits);
+}
+} // namespace
+
+bool MovementDelta::operator==(const MovementDelta& acRhs) const noexcept
+{
+    return Changes == acRhs.Changes && CellId == acRhs.CellId && WorldSpaceId == acRhs.WorldSpaceId && PositionResidual == acRhs.PositionResidual && Rotation == acRhs.Rotation &&
+           VariableChanges == acRhs.VariableChanges && Variables == acRhs.Variables && Direction == acRhs.Direction;
+}
+
+bool MovementDelta::operator!=(const MovementDelta& acRhs) const noexcept
+{
+    return !this->operator==(acRhs);
+}
+
+MovementDelta MovementDelta::Make(const Movement& acBaseline, const Movement& acMovement) noexcept
+{
+    MovementDelta delta;
+
+    if (acBaseline.CellId != acMovement.CellId || acBaseline.WorldSpaceId != acMovement.WorldSpaceId)
+    {
+        delta.Changes |= kCell;
+        delta.CellId = acMovement.CellId;
+        delta.WorldSpaceId = acMovement.WorldSpaceId;
+    }
+
+    delta.PositionResidual = Quantize(acMovement.Position) - Quantize(acBaseline.Position);
+    if (delta.PositionResidual != glm::ivec3{})
+        delta.Changes |= kPosition;
+
+    if (acBaseline.Rotation != acMovement.Rotation)
+    {
+        delta.Changes |= kRotation;
+        delta.Rotation = acMovement.Rotation;
+    }
+
+    const auto& cBaseVariables = acBaseline.Variables;
+    const auto& cVariables = acMovement.Variables;
+    const bool cResized = cBaseVariables.Integers.size() != cVariables.Integers.size() || cBaseVariables.Floats.size() != cVariables.Floats.size();
+
+    uint64_t changes = 0;
+    uint32_t idx = 0;
+
+    if (cResized || cBaseVariables.Booleans != cVariables.Booleans)
+        changes |= (1ull << idx);
+    ++idx;
+
+    for (auto i = 0u; i < cVariables.Integers.size() && idx < 64; ++i, ++idx)
+    {
+        if (cResized || cBaseVariables.Integers[i] != cVariables.Integers[i])
+            changes |= (1ull << idx);
+    }
+
+    for (auto i = 0u; i < cVariables.Floats.size() && idx < 64; ++i, ++idx)
+    {
+        if (cResized || cBaseVariables.Floats[i] != cVariables.Floats[i])
+            changes |= (1ull << idx);
+    }
+
+    // Too many variables to fit the change mask, the recipient keeps its previous ones
+    if (changes != 0 && cVariables.Integers.size() + cVariables.Floats.size() <= cMaxVariableCount)
+    {
+        delta.Changes |= kVariables;
+        delta.VariableChanges = changes;
+
+        auto& variables = delta.Variables;
+        variables.Integers.assign(cVariables.Integers.size(), 0);
+        variables.Floats.assign(cVariables.Floats.size(), 0.f);
+
+        idx = 0;
+
+        if (changes & (1ull << idx))
+            variables.Booleans = cVariables.Booleans;
+        ++idx;
+
+        for (auto i = 0u; i < cVariables.Integers.size(); ++i, ++idx)
+        {
+            if (changes & (1ull << idx))
+                variables.Integers[i] = cVariables.Integers[i];
+        }
+
+        for (auto i = 0u; i < cVariables.Floats.size(); ++i, ++idx)
+        {
+            if (changes & (1ull << idx))
+                variables.Floats[i] = cVariables.Floats[i];
+        }
+    }
+
+    if (acBaseline.Direction != acMovement.Direction)
+    {
+        delta.Changes |= kDirection;
+        delta.Direction = acMovement.Direction;
+    }
+
+    return delta;
+}
+
+MovementDelta MovementDelta::MakeKeyframe(const Movement& acMovement) noexcept
+{
+    MovementDelta delta = Make(Movement{}, acMovement);
+    delta.Changes |= kKeyframe;
+
+    return delta;
+}
+
+void MovementDelta::Apply(Movement& aBaseline) const noexcept
+{
+    if (Changes & kKeyframe)
+        aBaseline = Movement{};
+
+    if (Changes & kCell)
+    {
+        aBaseline.CellId = CellId;
+        aBaseline.WorldSpaceId = WorldSpaceId;
+    }
+
+    if (Changes & kPosition)
+    {
+        const auto cPosition = Quantize(aBaseline.Position) + PositionResidual;
+        aBaseline.Position = glm::vec3(cPosition);
+    }
+
+    if (Changes & kRotation)
+        aBaseline.Rotation = Rotation;
+
+    if (Changes & kVariables)
+    {
+        auto& variables = aBaseline.Variables;
+
+        if (variables.Integers.size() != Variables.Integers.size())
+            variables.Integers.assign(Variables.Integers.size(), 0);
+        if (variables.Floats.size() != Variables.Floats.size())
+            variables.Floats.assign(Variables.Floats.size(), 0.f);
+
+        uint32_t idx = 0;
+
+        if (VariableChanges & (1ull << idx))
+            variables.Booleans = Variables.Booleans;
+        ++idx;
+
+        for (auto i = 0u; i < Variables.Integers.size(); ++i, ++idx)
+        {
+            if (VariableChanges & (1ull << idx))
+                variables.Integers[i] = Variables.Integers[i];
+        }
+
+        for (auto i = 0u; i < Variables.Floats.size(); ++i, ++idx)
+        {
+            if (VariableChanges & (1ull << idx))
+                variables.Floats[i] = Variables.Floats[i];
+        }
+    }
+
+    if (Changes & kDirection)
+        aBaseline.Direction = Direction;
+}
+
+void MovementDelta::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    aWriter.WriteBits(Changes, kFlagBitCount);
+
+    if (Changes & kCell)
+    {
+        CellId.Serialize(aWriter);
+        WorldSpaceId.Serialize(aWriter);
+    }
+
+    if (Changes & kPosition)
+    {
+        Serialization::WriteVarInt(aWriter, ZigZagEncode(PositionResidual.x));
+        Serialization::WriteVarInt(aWriter, ZigZagEncode(PositionResidual.y));
+        Serialization::WriteVarInt(aWriter, ZigZagEncode(PositionResidual.z));
+    }
+
+    if (Changes & kRotation)
+        Rotation.Serialize(aWriter);
+
+    if (Changes & kVariables)
+    {
+        Serialization::WriteVarInt(aWriter, Variables.Integers.size());
+        Serialization::WriteVarInt(aWriter, Variables.Floats.size());
+
+        const auto cDiffBitCount = 1 + Variables.Integers.size() + Variables.Floats.size();
+        aWriter.WriteBits(VariableChanges, cDiffBitCount);
+
+        uint32_t idx = 0;
+
+        if (VariableChanges & (1ull << idx))
+            aWriter.WriteBits(Variables.Booleans, 64);
+        ++idx;
+
+        for (const auto value : Variables.Integers)
+        {
+            if (VariableChanges & (1ull << idx))
+                Serialization::WriteVarInt(aWriter, value & 0xFFFFFFFF);
+            ++idx;
+        }
+
+        for (const auto value : Variables.Floats)
+        {
+            if (VariableChanges & (1ull << idx))
+                aWriter.WriteBits(FloatBits(value), 32);
+            ++idx;
+        }
+    }
+
+    if (Changes & kDirection)
+        aWriter.WriteBits(FloatBits(Direction), 32);
+}
+
+void MovementDelta::Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept
+{
+    *this = MovementDelta{};
+
+    uint64_t changes = 0;
+    aReader.ReadBits(changes, kFlagBitCount);
+    Changes = changes & 0xFF;
+
+    if (Changes & kCell)
+    {
+        CellId.Deserialize(aReader);
+        WorldSpaceId.Deserialize(aReader);
+    }
+
+    if (Changes & kPosition)
+    {
+        PositionResidual.x = ZigZagDecode(Serialization::ReadVarInt(aReader));
+        PositionResidual.y = ZigZagDecode(Serialization::ReadVarInt(aReader));
+        PositionResidual.z = ZigZagDecode(Serialization::ReadVarInt(aReader));
+    }
+
+    if (Changes & kRotation)
+        Rotation.Deserialize(aReader);
+
+    if (Changes & kVariables)
+    {
+        const auto cIntegersSize = Serialization::ReadVarInt(aReader);
+        const auto cFloatsSize = Serialization::ReadVarInt(aReader);
+
+        // Malformed packet, drop the variables rather than reading past the change mask
+        if (cIntegersSize + cFloatsSize > cMaxVariableCount)
+        {
+            Changes = static_cast<uint8_t>(Changes & ~kVariables);
+        }
+        else
+        {
+            Variables.Integers.assign(cIntegersSize, 0);
+            Variables.Floats.assign(cFloatsSize, 0.f);
+
+            const auto cDiffBitCount = 1 + cIntegersSize + cFloatsSize;
+            aReader.ReadBits(VariableChanges, cDiffBitCount);
+
+            uint32_t idx = 0;
+
+            if (VariableChanges & (1ull << idx))
+                aReader.ReadBits(Variables.Booleans, 64);
+            ++idx;
+
+            for (auto& value : Variables.Integers)
+            {
+                if (VariableChanges & (1ull << idx))
+                    value = Serialization::ReadVarInt(aReader) & 0xFFFFFFFF;
+                ++idx;
+            }
+
+            for (auto& value : Variables.Floats)
+            {
+                if (VariableChanges & (1ull << idx))
+                {
+                    uint64_t tmp = 0;
+                    aReader.ReadBits(tmp, 32);
+                    value = BitsFloat(tmp);
+                }
+                ++idx;
+            }
+        }
+    }
+
+    if (Changes & kDirection)
+    {
+        uint64_t tmp = 0;
+        aReader.ReadBits(tmp, 32);
+        Direction = BitsFloat(tmp);
+    }
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Structs/Movement.h>
+
+using TiltedPhoques::Buffer;
+
+/**
+ * Changes between the last movement a recipient got for a reference and the current one.
+ *
+ * The delta is decoded without knowing the baseline, the receiver applies it on top of the
+ * last movement it has for the same reference. Keyframes apply on top of an empty movement.
+ */
+struct MovementDelta
+{
+    enum Flags : uint8_t
+    {
+        kKeyframe = 1 << 0,
+        kCell = 1 << 1,
+        kPosition = 1 << 2,
+        kRotation = 1 << 3,
+        kVariables = 1 << 4,
+        kDirection = 1 << 5,
+
+        kFlagBitCount = 6
+    };
+
+    MovementDelta() = default;
+    ~MovementDelta() = default;
+
+    bool operator==(const MovementDelta& acRhs) const noexcept;
+    bool operator!=(const MovementDelta& acRhs) const noexcept;
+
+    /**
+     * Builds the delta turning a baseline the recipient already has into a new movement.
+     * @param acBaseline The last movement sent to the recipient.
+     * @param acMovement The movement to send.
+     */
+    [[nodiscard]] static MovementDelta Make(const Movement& acBaseline, const Movement& acMovement) noexcept;
+    /**
+     * Builds a delta that does not depend on any baseline.
+     * @param acMovement The movement to send.
+     */
+    [[nodiscard]] static MovementDelta MakeKeyframe(const Movement& acMovement) noexcept;
+
+    /**
+     * Applies the delta to the last movement received for the reference.
+     * @param aBaseline The baseline, updated in place.
+     */
+    void Apply(Movement& aBaseline) const noexcept;
+
+    void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    void Deserialize(TiltedPhoques::Buffer::Reader& aReader) noexcept;
+
+    [[nodiscard]] bool IsKeyframe() const noexcept { return (Changes & kKeyframe) != 0; }
+
+    uint8_t Changes{0};
+    GameId CellId{};
+    GameId WorldSpaceId{};
+    // Offset from the baseline in whole units, the precision of Vector3_NetQuantize
+    glm::ivec3 PositionResidual{};
+    Rotator2_NetQuantize Rotation{};
+    // Bit 0 is the booleans, followed by the integers and then the floats
+    uint64_t VariableChanges{0};
+    // Sized like the new variables, only the entries flagged in VariableChanges are meaningful
+    AnimationVariables Variables{};
+    float Direction{};
+};
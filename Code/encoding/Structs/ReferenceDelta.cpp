@@ -0,0 +1,45 @@
+#include <Structs/ReferenceDelta.h>
+#include <TiltedCore/Serialization.hpp>
+
+using TiltedPhoques::Serialization;
+
+bool ReferenceDelta::operator==(const ReferenceDelta& acRhs) const noexcept
+{
+    return UpdatedMovement == acRhs.UpdatedMovement && ActionEvents == acRhs.ActionEvents;
+}
+
+bool ReferenceDelta::operator!=(const ReferenceDelta& acRhs) const noexcept
+{
+    return !this->operator==(acRhs);
+}
+
+void ReferenceDelta::Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept
+{
+    Serialize(aWriter, UpdatedMovement, ActionEvents);
+}
+
+void ReferenceDelta::Serialize(TiltedPhoques::Buffer::Writer& aWriter, const MovementDelta& acMovement, const Vector<ActionEvent>& acActionEvents) noexcept
+{
+    acMovement.Serialize(aWriter);
+
+    Serialization::WriteVarInt(aWriter, acActionEvents.size());
+
+    for (auto& entry : acActionEvents)
+    {
+        entry.GenerateDifferential(ActionEvent{}, aWriter);
+    }
+}
+
+void ReferenceDelta::Deserialize(TiltedPhoques::Buffer::Reader& aReader)
+{
+    UpdatedMovement.Deserialize(aReader);
+
+    const auto count = Serialization::ReadVarInt(aReader);
+
+    ActionEvents.resize(count);
+
+    for (auto i = 0u; i < count; ++i)
+    {
+        ActionEvents[i].ApplyDifferential(aReader);
+    }
+}
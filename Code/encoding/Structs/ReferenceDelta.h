@@ -0,0 +1,27 @@
+#pragma once
+
+#include <Structs/MovementDelta.h>
+#include <Structs/ActionEvent.h>
+
+using TiltedPhoques::Buffer;
+using TiltedPhoques::Vector;
+
+struct ReferenceDelta
+{
+    ReferenceDelta() = default;
+    ~ReferenceDelta() = default;
+
+    bool operator==(const ReferenceDelta& acRhs) const noexcept;
+    bool operator!=(const ReferenceDelta& acRhs) const noexcept;
+
+    void Serialize(TiltedPhoques::Buffer::Writer& aWriter) const noexcept;
+    void Deserialize(TiltedPhoques::Buffer::Reader& aReader);
+
+    /**
+     * Writes the same bytes as Serialize without having to copy the parts into a ReferenceDelta.
+     */
+    static void Serialize(TiltedPhoques::Buffer::Writer& aWriter, const MovementDelta& acMovement, const Vector<ActionEvent>& acActionEvents) noexcept;
+
+    MovementDelta UpdatedMovement{};
+    Vector<ActionEvent> ActionEvents{};
+};
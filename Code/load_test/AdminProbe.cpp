@@ -0,0 +1,137 @@
+#include "AdminProbe.h"
+
+#include <AdminMessages/AdminStatsRequest.h>
+#include <AdminMessages/ServerAdminMessageFactory.h>
+#include <Messages/AuthenticationRequest.h>
+
+#include <Packet.hpp>
+#include <TiltedCore/ScratchAllocator.hpp>
+#include <TiltedCore/ViewBuffer.hpp>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// The server rotates its profile every 10 seconds, polling faster only picks the same report again
+constexpr auto kRequestInterval = 5s;
+} // namespace
+
+AdminProbe::AdminProbe(String aPassword) noexcept
+    : m_password(std::move(aPassword))
+{
+}
+
+void AdminProbe::Tick(Clock::time_point aNow) noexcept
+{
+    if (!m_sessionOpen || aNow < m_nextRequest)
+        return;
+
+    m_nextRequest = aNow + kRequestInterval;
+
+    AdminStatsRequest request;
+    Send(request);
+}
+
+void AdminProbe::OnConsume(const void* apData, uint32_t aSize)
+{
+    ServerAdminMessageFactory factory;
+    TiltedPhoques::ViewBuffer buf((uint8_t*)apData, aSize);
+    Buffer::Reader reader(&buf);
+
+    auto pMessage = factory.Extract(reader);
+    if (!pMessage)
+        return;
+
+    switch (pMessage->GetOpcode())
+    {
+    case kAdminSessionOpen:
+        spdlog::info("Admin session open, server tick times will be reported");
+        m_sessionOpen = true;
+        break;
+    case kServerTickStats:
+        m_stats = std::move(static_cast<ServerTickStats&>(*pMessage));
+        m_hasStats = true;
+        break;
+    default: break;
+    }
+}
+
+void AdminProbe::OnConnected()
+{
+    AuthenticationRequest request{};
+    request.Version = BUILD_COMMIT;
+    request.Token = m_password;
+
+    Send(request);
+}
+
+void AdminProbe::OnDisconnected(EDisconnectReason aReason)
+{
+    // A refused admin password ends with a kick as the response is not an admin message
+    if (!m_sessionOpen)
+        spdlog::warn("Admin session refused, is GameServer:sAdminPassword set on the server?");
+    else
+        spdlog::warn("Admin session closed {}", aReason);
+
+    m_sessionOpen = false;
+}
+
+void AdminProbe::OnUpdate()
+{
+}
+
+bool AdminProbe::Send(const ClientAdminMessage& acMessage) const noexcept
+{
+    static thread_local TiltedPhoques::ScratchAllocator s_allocator(1 << 18);
+
+    struct ScopedReset
+    {
+        ~ScopedReset() { s_allocator.Reset(); }
+    } allocatorGuard;
+
+    if (IsConnected())
+    {
+        TiltedPhoques::ScopedAllocator _{s_allocator};
+
+        Buffer buffer(1 << 16);
+        Buffer::Writer writer(&buffer);
+        writer.WriteBits(0, 8); // Write first byte as packet needs it
+
+        acMessage.Serialize(writer);
+        TiltedPhoques::PacketView packet(reinterpret_cast<char*>(buffer.GetWriteData()), writer.Size());
+
+        Client::Send(&packet);
+
+        return true;
+    }
+
+    return false;
+}
+
+bool AdminProbe::Send(const ClientMessage& acMessage) const noexcept
+{
+    static thread_local TiltedPhoques::ScratchAllocator s_allocator(1 << 18);
+
+    struct ScopedReset
+    {
+        ~ScopedReset() { s_allocator.Reset(); }
+    } allocatorGuard;
+
+    if (IsConnected())
+    {
+        TiltedPhoques::ScopedAllocator _{s_allocator};
+
+        Buffer buffer(1 << 16);
+        Buffer::Writer writer(&buffer);
+        writer.WriteBits(0, 8); // Write first byte as packet needs it
+
+        acMessage.Serialize(writer);
+        TiltedPhoques::PacketView packet(reinterpret_cast<char*>(buffer.GetWriteData()), writer.Size());
+
+        Client::Send(&packet);
+
+        return true;
+    }
+
+    return false;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <AdminMessages/Message.h>
+#include <AdminMessages/ServerTickStats.h>
+#include <Messages/Message.h>
+
+#include <Client.hpp>
+
+/**
+ * @brief Admin session polling the server's tick profile while the bots run.
+ */
+struct AdminProbe : TiltedPhoques::Client
+{
+    using Clock = std::chrono::steady_clock;
+
+    explicit AdminProbe(String aPassword) noexcept;
+    ~AdminProbe() noexcept = default;
+
+    TP_NOCOPYMOVE(AdminProbe);
+
+    void Tick(Clock::time_point aNow) noexcept;
+
+    [[nodiscard]] bool IsSessionOpen() const noexcept { return m_sessionOpen; }
+    /**
+     * @brief Returns the last report received, null until the server sent one.
+     */
+    [[nodiscard]] const ServerTickStats* GetStats() const noexcept { return m_hasStats ? &m_stats : nullptr; }
+
+    void OnConsume(const void* apData, uint32_t aSize) override;
+    void OnConnected() override;
+    void OnDisconnected(EDisconnectReason aReason) override;
+    void OnUpdate() override;
+
+protected:
+    bool Send(const ClientAdminMessage& acMessage) const noexcept;
+    bool Send(const ClientMessage& acMessage) const noexcept;
+
+private:
+    String m_password;
+    bool m_sessionOpen{false};
+    bool m_hasStats{false};
+    ServerTickStats m_stats{};
+    Clock::time_point m_nextRequest{};
+};
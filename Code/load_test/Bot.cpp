@@ -0,0 +1,386 @@
+#include "Bot.h"
+
+#include <Messages/AssignCharacterRequest.h>
+#include <Messages/AssignCharacterResponse.h>
+#include <Messages/AuthenticationRequest.h>
+#include <Messages/AuthenticationResponse.h>
+#include <Messages/ClientReferencesMoveRequest.h>
+#include <Messages/EnterExteriorCellRequest.h>
+#include <Messages/NotifyChatMessageBroadcast.h>
+#include <Messages/RequestInventoryChanges.h>
+#include <Messages/SendChatMessageRequest.h>
+#include <Messages/ServerMessageFactory.h>
+#include <Messages/SpellCastRequest.h>
+#include <Messages/StringCacheUpdate.h>
+#include <StringCache.h>
+
+#include <Packet.hpp>
+#include <TiltedCore/ScratchAllocator.hpp>
+#include <TiltedCore/ViewBuffer.hpp>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+// Cadences of the game client
+constexpr auto kMovementInterval = 100ms;
+constexpr auto kActionInterval = 3s;
+constexpr auto kInventoryInterval = 5s;
+constexpr auto kSpellInterval = 4s;
+constexpr auto kChatInterval = 2s;
+
+constexpr char kPingPrefix[] = "ping ";
+
+// Humanoid behavior graphs expose about this many synced variables
+constexpr size_t kIntegerVariableCount = 8;
+constexpr size_t kFloatVariableCount = 24;
+constexpr size_t kAppearanceSize = 1024;
+
+constexpr float kCellSize = 4096.f;
+constexpr float kRunSpeed = 350.f;
+constexpr float kPi = 3.14159265f;
+
+const GameId kPlayerReferenceId{0, 0x14};
+const GameId kPlayerBaseId{0, 0x7};
+const GameId kGoldId{0, 0xF};
+const GameId kIronSwordId{0, 0x12EB7};
+const GameId kFlamesId{0, 0x12FCD};
+
+enum ActorValue : uint32_t
+{
+    kHealth = 24,
+    kMagicka = 25,
+    kStamina = 26
+};
+
+template <class T> Bot::Clock::time_point Stagger(Bot::Clock::time_point aNow, T aInterval, std::mt19937& aRandom)
+{
+    std::uniform_int_distribution<int64_t> distribution(0, std::chrono::duration_cast<std::chrono::milliseconds>(aInterval).count());
+    return aNow + std::chrono::milliseconds(distribution(aRandom));
+}
+} // namespace
+
+Bot::Bot(uint32_t aIndex, Config aConfig) noexcept
+    : m_index(aIndex)
+    , m_config(std::move(aConfig))
+    , m_random(aIndex)
+{
+    // Walk in a circle inside the assigned cell so the bot never changes cell on its own
+    std::uniform_real_distribution<float> radius(kCellSize * 0.1f, kCellSize * 0.4f);
+    std::uniform_real_distribution<float> angle(0.f, 2.f * kPi);
+
+    m_center = glm::vec3(m_config.Coords.X * kCellSize + kCellSize / 2.f, m_config.Coords.Y * kCellSize + kCellSize / 2.f, 0.f);
+    m_radius = radius(m_random);
+    m_angle = angle(m_random);
+
+    m_movement.CellId = m_config.CellId;
+    m_movement.WorldSpaceId = m_config.WorldSpaceId;
+    m_movement.Position = m_center + glm::vec3(std::cos(m_angle), std::sin(m_angle), 0.f) * m_radius;
+    m_movement.Variables.Integers.assign(kIntegerVariableCount, 0);
+    m_movement.Variables.Floats.assign(kFloatVariableCount, 0.f);
+}
+
+void Bot::Tick(Clock::time_point aNow) noexcept
+{
+    if (m_state != State::kPlaying)
+        return;
+
+    if (aNow >= m_nextMovement)
+    {
+        m_nextMovement = std::max(m_nextMovement + kMovementInterval, aNow);
+        SendMovement(aNow);
+    }
+
+    if (aNow >= m_nextInventory)
+    {
+        m_nextInventory = aNow + kInventoryInterval;
+        SendInventoryChange();
+    }
+
+    if (aNow >= m_nextSpell)
+    {
+        m_nextSpell = aNow + kSpellInterval;
+        SendSpellCast();
+    }
+
+    if (aNow >= m_nextChat)
+    {
+        m_nextChat = aNow + kChatInterval;
+        SendChat(aNow);
+    }
+}
+
+Bot::Counters Bot::TakeCounters() noexcept
+{
+    Counters counters = std::move(m_counters);
+    m_counters = {};
+
+    return counters;
+}
+
+void Bot::OnConsume(const void* apData, uint32_t aSize)
+{
+    m_counters.BytesReceived += aSize;
+    ++m_counters.MessagesReceived;
+
+    ServerMessageFactory factory;
+    TiltedPhoques::ViewBuffer buf((uint8_t*)apData, aSize);
+    Buffer::Reader reader(&buf);
+
+    auto pMessage = factory.Extract(reader);
+    if (!pMessage)
+    {
+        spdlog::error("{} couldn't parse packet from server", m_config.Username.c_str());
+        return;
+    }
+
+    // Everything else is only counted, decoding it is enough to account for the client side cost
+    switch (pMessage->GetOpcode())
+    {
+    case kAuthenticationResponse: HandleMessage(static_cast<const AuthenticationResponse&>(*pMessage)); break;
+    case kAssignCharacterResponse: HandleMessage(static_cast<const AssignCharacterResponse&>(*pMessage)); break;
+    case kNotifyChatMessageBroadcast: HandleMessage(static_cast<const NotifyChatMessageBroadcast&>(*pMessage)); break;
+    case kStringCacheUpdate: HandleMessage(static_cast<const StringCacheUpdate&>(*pMessage)); break;
+    default: break;
+    }
+}
+
+void Bot::OnConnected()
+{
+    m_state = State::kAuthenticating;
+    m_start = Clock::now();
+
+    AuthenticationRequest request{};
+    request.Version = BUILD_COMMIT;
+    request.Token = m_config.Password;
+    request.Username = m_config.Username;
+    request.WorldSpaceId = m_config.WorldSpaceId;
+    request.CellId = m_config.CellId;
+    request.Level = 10;
+
+    uint16_t id = 0;
+    for (const auto& mod : m_config.Mods)
+    {
+        auto& entry = request.UserMods.ModList.emplace_back();
+        entry.Id = id++;
+        entry.IsLite = false;
+        entry.Filename = mod;
+    }
+
+    Send(request);
+}
+
+void Bot::OnDisconnected(EDisconnectReason aReason)
+{
+    if (m_state != State::kDisconnected)
+        spdlog::warn("{} disconnected from server {}", m_config.Username.c_str(), aReason);
+
+    m_state = State::kDisconnected;
+}
+
+void Bot::OnUpdate()
+{
+}
+
+bool Bot::Send(const ClientMessage& acMessage) noexcept
+{
+    static thread_local TiltedPhoques::ScratchAllocator s_allocator(1 << 18);
+
+    struct ScopedReset
+    {
+        ~ScopedReset() { s_allocator.Reset(); }
+    } allocatorGuard;
+
+    if (IsConnected())
+    {
+        TiltedPhoques::ScopedAllocator _{s_allocator};
+
+        Buffer buffer(1 << 16);
+        Buffer::Writer writer(&buffer);
+        writer.WriteBits(0, 8); // Write first byte as packet needs it
+
+        acMessage.Serialize(writer);
+        TiltedPhoques::PacketView packet(reinterpret_cast<char*>(buffer.GetWriteData()), writer.Size());
+
+        Client::Send(&packet);
+
+        m_counters.BytesSent += writer.Size();
+        ++m_counters.MessagesSent;
+
+        return true;
+    }
+
+    return false;
+}
+
+void Bot::HandleMessage(const AuthenticationResponse& acMessage) noexcept
+{
+    if (acMessage.Type != AuthenticationResponse::ResponseType::kAccepted)
+    {
+        spdlog::error("{} was refused by the server, reason {}", m_config.Username.c_str(), static_cast<uint32_t>(acMessage.Type));
+        m_state = State::kDisconnected;
+        return;
+    }
+
+    m_state = State::kSpawning;
+
+    AssignCharacterRequest request{};
+    request.Cookie = m_index;
+    request.ReferenceId = kPlayerReferenceId;
+    request.FormId = kPlayerBaseId;
+    request.CellId = m_movement.CellId;
+    request.WorldSpaceId = m_movement.WorldSpaceId;
+    request.Position = m_movement.Position;
+    request.Rotation = m_movement.Rotation;
+    request.AppearanceBuffer = String(kAppearanceSize, 'a');
+
+    auto& gold = request.InventoryContent.Entries.emplace_back();
+    gold.BaseId = kGoldId;
+    gold.Count = 100;
+
+    auto& sword = request.InventoryContent.Entries.emplace_back();
+    sword.BaseId = kIronSwordId;
+    sword.Count = 1;
+    sword.ExtraWorn = true;
+
+    for (const auto cActorValue : {kHealth, kMagicka, kStamina})
+    {
+        request.AllActorValues.ActorValuesList.Set(cActorValue, 100.f);
+        request.AllActorValues.ActorMaxValuesList.Set(cActorValue, 100.f);
+    }
+
+    Send(request);
+}
+
+void Bot::HandleMessage(const AssignCharacterResponse& acMessage) noexcept
+{
+    if (m_state != State::kSpawning || acMessage.Cookie != m_index)
+        return;
+
+    m_serverId = acMessage.ServerId;
+
+    EnterExteriorCellRequest request{};
+    request.CellId = m_config.CellId;
+    request.WorldSpaceId = m_config.WorldSpaceId;
+    request.CurrentCoords = m_config.Coords;
+
+    Send(request);
+
+    // Spread the bots' traffic instead of having all of them send in the same millisecond
+    const auto cNow = Clock::now();
+    m_nextMovement = Stagger(cNow, kMovementInterval, m_random);
+    m_nextAction = Stagger(cNow, kActionInterval, m_random);
+    m_nextInventory = Stagger(cNow, kInventoryInterval, m_random);
+    m_nextSpell = Stagger(cNow, kSpellInterval, m_random);
+    m_nextChat = Stagger(cNow, kChatInterval, m_random);
+
+    m_state = State::kPlaying;
+}
+
+void Bot::HandleMessage(const NotifyChatMessageBroadcast& acMessage) noexcept
+{
+    if (acMessage.PlayerName != m_config.Username || !acMessage.ChatMessage.starts_with(kPingPrefix))
+        return;
+
+    const auto cSent = std::strtoull(acMessage.ChatMessage.c_str() + std::size(kPingPrefix) - 1, nullptr, 10);
+    const auto cNow = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now().time_since_epoch()).count();
+
+    if (cSent > 0 && static_cast<uint64_t>(cNow) >= cSent)
+        m_counters.Latencies.push_back(static_cast<uint32_t>(std::min<uint64_t>(cNow - cSent, std::numeric_limits<uint32_t>::max())));
+}
+
+void Bot::HandleMessage(const StringCacheUpdate& acMessage) noexcept
+{
+    // Bots share the process wide cache and the server hands out the same ids to everyone, so
+    // only the strings past the end of the cache are new
+    auto& cache = StringCache::Get();
+
+    for (size_t i = 0; i < acMessage.Values.size(); ++i)
+    {
+        if (acMessage.StartId + i == cache.Size())
+            cache.Add(acMessage.Values[i]);
+    }
+}
+
+void Bot::SendMovement(Clock::time_point aNow) noexcept
+{
+    const float cDeltaSeconds = std::chrono::duration_cast<std::chrono::duration<float>>(kMovementInterval).count();
+
+    ClientReferencesMoveRequest message;
+    message.Tick = std::chrono::duration_cast<std::chrono::milliseconds>(aNow - m_start).count();
+
+    auto& update = message.Updates[m_serverId];
+
+    if (aNow >= m_nextAction)
+    {
+        m_nextAction = aNow + kActionInterval;
+        m_moving = !m_moving;
+
+        auto& action = update.ActionEvents.emplace_back();
+        action.Tick = message.Tick;
+        action.ActorId = m_serverId;
+        action.ActionId = m_moving ? 1 : 2;
+        action.EventName = m_moving ? "moveStart" : "moveStop";
+        action.Variables = m_movement.Variables;
+    }
+
+    auto& variables = m_movement.Variables;
+
+    if (m_moving)
+    {
+        m_angle = std::fmod(m_angle + kRunSpeed * cDeltaSeconds / m_radius, 2.f * kPi);
+
+        m_movement.Position = m_center + glm::vec3(std::cos(m_angle), std::sin(m_angle), 0.f) * m_radius;
+        m_movement.Rotation.y = m_angle + kPi / 2.f;
+
+        variables.Booleans |= 1;
+        variables.Floats[0] = kRunSpeed;
+        variables.Floats[1] = m_movement.Rotation.y;
+    }
+    else
+    {
+        variables.Booleans &= ~1ull;
+        variables.Floats[0] = 0.f;
+    }
+
+    update.UpdatedMovement = m_movement;
+
+    Send(message);
+}
+
+void Bot::SendInventoryChange() noexcept
+{
+    // Alternate gaining and losing a coin so the inventory does not grow over long runs
+    RequestInventoryChanges request{};
+    request.ServerId = m_serverId;
+    request.Item.BaseId = kGoldId;
+    request.Item.Count = m_goldDelta;
+
+    m_goldDelta = -m_goldDelta;
+
+    Send(request);
+}
+
+void Bot::SendSpellCast() noexcept
+{
+    SpellCastRequest request{};
+    request.CasterId = m_serverId;
+    request.SpellFormId = kFlamesId;
+    request.CastingSource = 0;
+    request.IsDualCasting = false;
+    request.DesiredTarget = 0;
+
+    Send(request);
+}
+
+void Bot::SendChat(Clock::time_point aNow) noexcept
+{
+    const auto cNow = std::chrono::duration_cast<std::chrono::microseconds>(aNow.time_since_epoch()).count();
+
+    SendChatMessageRequest request{};
+    request.MessageType = kGlobalChat;
+    request.ChatMessage = kPingPrefix;
+    request.ChatMessage += std::to_string(cNow).c_str();
+
+    Send(request);
+}
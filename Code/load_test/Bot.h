@@ -0,0 +1,111 @@
+#pragma once
+
+#include <Messages/Message.h>
+#include <Structs/GameId.h>
+#include <Structs/GridCellCoords.h>
+#include <Structs/Movement.h>
+
+#include <Client.hpp>
+
+struct AuthenticationResponse;
+struct AssignCharacterResponse;
+struct NotifyChatMessageBroadcast;
+struct StringCacheUpdate;
+
+/**
+ * @brief Simulated player speaking the game protocol.
+ *
+ * A bot authenticates, spawns its character and then streams movement, inventory, spell and chat
+ * traffic at the rates of a game client. Chat messages carry their send time so the bot can
+ * measure the round trip when the server broadcasts them back.
+ */
+struct Bot : TiltedPhoques::Client
+{
+    using Clock = std::chrono::steady_clock;
+
+    enum class State
+    {
+        kIdle,
+        kAuthenticating,
+        kSpawning,
+        kPlaying,
+        kDisconnected
+    };
+
+    struct Config
+    {
+        String Username;
+        String Password;
+        Vector<String> Mods;
+        GameId WorldSpaceId;
+        GameId CellId;
+        GridCellCoords Coords;
+    };
+
+    struct Counters
+    {
+        uint64_t BytesSent{0};
+        uint64_t BytesReceived{0};
+        uint64_t MessagesSent{0};
+        uint64_t MessagesReceived{0};
+        // Chat round trips in microseconds
+        Vector<uint32_t> Latencies;
+    };
+
+    Bot(uint32_t aIndex, Config aConfig) noexcept;
+    ~Bot() noexcept = default;
+
+    TP_NOCOPYMOVE(Bot);
+
+    /**
+     * @brief Sends the traffic that is due, the network itself is pumped by Client::Update.
+     */
+    void Tick(Clock::time_point aNow) noexcept;
+
+    [[nodiscard]] State GetState() const noexcept { return m_state; }
+    /**
+     * @brief Returns the counters accumulated since the last call and resets them.
+     */
+    [[nodiscard]] Counters TakeCounters() noexcept;
+
+    void OnConsume(const void* apData, uint32_t aSize) override;
+    void OnConnected() override;
+    void OnDisconnected(EDisconnectReason aReason) override;
+    void OnUpdate() override;
+
+protected:
+    bool Send(const ClientMessage& acMessage) noexcept;
+
+    void HandleMessage(const AuthenticationResponse& acMessage) noexcept;
+    void HandleMessage(const AssignCharacterResponse& acMessage) noexcept;
+    void HandleMessage(const NotifyChatMessageBroadcast& acMessage) noexcept;
+    void HandleMessage(const StringCacheUpdate& acMessage) noexcept;
+
+    void SendMovement(Clock::time_point aNow) noexcept;
+    void SendInventoryChange() noexcept;
+    void SendSpellCast() noexcept;
+    void SendChat(Clock::time_point aNow) noexcept;
+
+private:
+    uint32_t m_index;
+    Config m_config;
+    State m_state{State::kIdle};
+    Counters m_counters{};
+
+    uint32_t m_serverId{0};
+    Movement m_movement{};
+    glm::vec3 m_center{};
+    float m_radius{0.f};
+    float m_angle{0.f};
+    bool m_moving{false};
+    int32_t m_goldDelta{1};
+
+    Clock::time_point m_start{};
+    Clock::time_point m_nextMovement{};
+    Clock::time_point m_nextAction{};
+    Clock::time_point m_nextInventory{};
+    Clock::time_point m_nextSpell{};
+    Clock::time_point m_nextChat{};
+
+    std::mt19937 m_random;
+};
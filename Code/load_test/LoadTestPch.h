@@ -0,0 +1,24 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <optional>
+#include <random>
+#include <thread>
+
+#include <TiltedCore/Stl.hpp>
+#include <TiltedCore/Allocator.hpp>
+#include <TiltedCore/Buffer.hpp>
+#include <TiltedCore/Serialization.hpp>
+
+#include <glm/glm.hpp>
+
+#include <spdlog/spdlog.h>
+
+#include <BuildInfo.h>
+
+using TiltedPhoques::Buffer;
+using TiltedPhoques::String;
+using TiltedPhoques::UniquePtr;
+using TiltedPhoques::Vector;
@@ -0,0 +1,238 @@
+#include "AdminProbe.h"
+#include "Bot.h"
+
+#include <csignal>
+
+#include <cxxopts.hpp>
+
+using namespace std::chrono_literals;
+
+namespace
+{
+constexpr char kDefaultMods[] = "Skyrim.esm,Update.esm,Dawnguard.esm,HearthFires.esm,Dragonborn.esm";
+// The server treats form ids as opaque keys, any exterior cell of Tamriel does the job
+constexpr uint32_t kTamrielId = 0x3C;
+constexpr uint32_t kDefaultCellId = 0x9732;
+
+std::atomic<bool> s_stop{false};
+
+void OnSignal(int)
+{
+    s_stop = true;
+}
+
+uint32_t Percentile(Vector<uint32_t>& aSamples, double aPercentile)
+{
+    if (aSamples.empty())
+        return 0;
+
+    const auto cIndex = std::min(static_cast<size_t>(aPercentile * aSamples.size()), aSamples.size() - 1);
+    std::nth_element(std::begin(aSamples), std::begin(aSamples) + cIndex, std::end(aSamples));
+
+    return aSamples[cIndex];
+}
+
+void Report(Vector<UniquePtr<Bot>>& aBots, const AdminProbe* apProbe, std::chrono::duration<double> aElapsed)
+{
+    const auto cSeconds = aElapsed.count();
+
+    size_t playing = 0;
+    uint64_t bytesSent = 0;
+    uint64_t bytesReceived = 0;
+    uint64_t maxBytesReceived = 0;
+    uint64_t messagesSent = 0;
+    uint64_t messagesReceived = 0;
+    Vector<uint32_t> latencies;
+
+    for (auto& pBot : aBots)
+    {
+        auto counters = pBot->TakeCounters();
+
+        if (pBot->GetState() == Bot::State::kPlaying)
+            ++playing;
+
+        bytesSent += counters.BytesSent;
+        bytesReceived += counters.BytesReceived;
+        maxBytesReceived = std::max(maxBytesReceived, counters.BytesReceived);
+        messagesSent += counters.MessagesSent;
+        messagesReceived += counters.MessagesReceived;
+        latencies.insert(std::end(latencies), std::begin(counters.Latencies), std::end(counters.Latencies));
+    }
+
+    spdlog::info("<------Load test-({}/{} playing)--->", playing, aBots.size());
+
+    if (playing > 0)
+    {
+        const auto cPerPlayer = static_cast<double>(playing) * cSeconds;
+
+        spdlog::info("Per player: up {:.1f} KiB/s ({:.1f} msg/s), down {:.1f} KiB/s ({:.1f} msg/s), worst down {:.1f} KiB/s",
+                     bytesSent / 1024.0 / cPerPlayer, messagesSent / cPerPlayer, bytesReceived / 1024.0 / cPerPlayer,
+                     messagesReceived / cPerPlayer, maxBytesReceived / 1024.0 / cSeconds);
+    }
+
+    if (!latencies.empty())
+    {
+        const auto cMax = *std::max_element(std::begin(latencies), std::end(latencies));
+
+        spdlog::info("Chat round trip: p50 {:.2f} ms, p99 {:.2f} ms, max {:.2f} ms ({} samples)", Percentile(latencies, 0.5) / 1000.0,
+                     Percentile(latencies, 0.99) / 1000.0, cMax / 1000.0, latencies.size());
+    }
+
+    const ServerTickStats* pStats = apProbe ? apProbe->GetStats() : nullptr;
+    if (!pStats)
+        return;
+
+    const auto cWindowSeconds = pStats->WindowMilliseconds / 1000.0;
+
+    for (const auto& section : pStats->Sections)
+    {
+        if (section.Name != "Tick")
+            continue;
+
+        spdlog::info("Server tick: {:.1f} ticks/s, p50 {} us, p99 {} us, max {} us", cWindowSeconds > 0 ? section.Count / cWindowSeconds : 0.0,
+                     section.MedianMicroseconds, section.P99Microseconds, section.MaxMicroseconds);
+    }
+
+    // Sections are sorted by total time, the tick itself comes first
+    constexpr size_t kTopSections = 6;
+    for (size_t i = 0; i < std::min(kTopSections, pStats->Sections.size()); ++i)
+    {
+        const auto& section = pStats->Sections[i];
+        if (section.Name == "Tick")
+            continue;
+
+        spdlog::info("  {}: {:.2f} ms/s, p99 {} us", section.Name.c_str(),
+                     cWindowSeconds > 0 ? section.TotalMicroseconds / 1000.0 / cWindowSeconds : 0.0, section.P99Microseconds);
+    }
+}
+} // namespace
+
+int main(int argc, char** argv)
+{
+    cxxopts::Options options("TiltedLoadTest", "Simulates players against a game server");
+
+    // clang-format off
+    options.add_options()
+        ("e,endpoint", "Server endpoint", cxxopts::value<std::string>()->default_value("127.0.0.1:10578"))
+        ("n,players", "Number of simulated players", cxxopts::value<uint32_t>()->default_value("16"))
+        ("p,password", "Server password", cxxopts::value<std::string>()->default_value(""))
+        ("a,admin-password", "Admin password, server tick times are only reported when set", cxxopts::value<std::string>()->default_value(""))
+        ("m,mods", "Mods the players pretend to have loaded", cxxopts::value<std::vector<std::string>>()->default_value(kDefaultMods))
+        ("s,spread", "Players are spread over spread x spread exterior cells", cxxopts::value<uint32_t>()->default_value("1"))
+        ("r,ramp", "Players connecting per second", cxxopts::value<uint32_t>()->default_value("8"))
+        ("d,duration", "Seconds to run for, runs until interrupted when 0", cxxopts::value<uint32_t>()->default_value("0"))
+        ("i,interval", "Seconds between reports", cxxopts::value<uint32_t>()->default_value("5"))
+        ("h,help", "Print usage");
+    // clang-format on
+
+    uint32_t playerCount, spread, ramp, duration, interval;
+    std::string endpoint, password, adminPassword;
+    std::vector<std::string> mods;
+
+    try
+    {
+        const auto result = options.parse(argc, argv);
+        if (result.count("help"))
+        {
+            fmt::print("{}\n", options.help());
+            return 0;
+        }
+
+        endpoint = result["endpoint"].as<std::string>();
+        playerCount = result["players"].as<uint32_t>();
+        password = result["password"].as<std::string>();
+        adminPassword = result["admin-password"].as<std::string>();
+        mods = result["mods"].as<std::vector<std::string>>();
+        spread = std::max(result["spread"].as<uint32_t>(), 1u);
+        ramp = std::max(result["ramp"].as<uint32_t>(), 1u);
+        duration = result["duration"].as<uint32_t>();
+        interval = std::max(result["interval"].as<uint32_t>(), 1u);
+    }
+    catch (const cxxopts::OptionException& e)
+    {
+        fmt::print("{}\n{}\n", e.what(), options.help());
+        return 1;
+    }
+
+    spdlog::set_pattern("%^[%H:%M:%S] [%l]%$ %v");
+
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+
+    Vector<UniquePtr<Bot>> bots;
+    bots.reserve(playerCount);
+
+    for (uint32_t i = 0; i < playerCount; ++i)
+    {
+        Bot::Config config;
+        config.Username = fmt::format("Bot{:04}", i).c_str();
+        config.Password = password.c_str();
+        config.WorldSpaceId = GameId(0, kTamrielId);
+        config.CellId = GameId(0, kDefaultCellId);
+        config.Coords = GridCellCoords(static_cast<int32_t>(i % spread), static_cast<int32_t>((i / spread) % spread));
+
+        for (const auto& mod : mods)
+            config.Mods.push_back(mod.c_str());
+
+        bots.push_back(TiltedPhoques::MakeUnique<Bot>(i, std::move(config)));
+    }
+
+    UniquePtr<AdminProbe> pProbe;
+    if (!adminPassword.empty())
+    {
+        pProbe = TiltedPhoques::MakeUnique<AdminProbe>(adminPassword.c_str());
+        pProbe->Connect(endpoint.c_str());
+    }
+
+    spdlog::info("Connecting {} players to {}, {} per second", playerCount, endpoint, ramp);
+
+    const auto cStart = Bot::Clock::now();
+    const auto cConnectInterval = std::chrono::duration_cast<Bot::Clock::duration>(1s) / ramp;
+    const auto cReportInterval = std::chrono::seconds(interval);
+
+    size_t connected = 0;
+    auto nextConnect = cStart;
+    auto lastReport = cStart;
+
+    while (!s_stop)
+    {
+        const auto cNow = Bot::Clock::now();
+
+        while (connected < bots.size() && cNow >= nextConnect)
+        {
+            bots[connected++]->Connect(endpoint.c_str());
+            nextConnect += cConnectInterval;
+        }
+
+        for (auto& pBot : bots)
+        {
+            pBot->Update();
+            pBot->Tick(cNow);
+        }
+
+        if (pProbe)
+        {
+            pProbe->Update();
+            pProbe->Tick(cNow);
+        }
+
+        if (cNow - lastReport >= cReportInterval)
+        {
+            Report(bots, pProbe.get(), cNow - lastReport);
+            lastReport = cNow;
+        }
+
+        if (duration > 0 && cNow - cStart >= std::chrono::seconds(duration))
+            break;
+
+        std::this_thread::sleep_for(1ms);
+    }
+
+    for (auto& pBot : bots)
+        pBot->Close();
+
+    if (pProbe)
+        pProbe->Close();
+
+    return 0;
+}
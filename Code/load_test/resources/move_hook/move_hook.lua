@@ -0,0 +1,4 @@
+-- Copy this folder into the server's resources folder and compare the ClientReferencesMoveRequest
+-- packet timings reported by the load test with and without it.
+addEventHandler("onCharacterMove", function(entity)
+end)
@@ -0,0 +1,24 @@
+
+target("LoadTest")
+    set_kind("binary")
+    set_group("Tests")
+    set_basename("TiltedLoadTest")
+    add_defines("TP_SKYRIM=1")
+    add_includedirs(
+        ".",
+        "../",
+        "../../Libraries/")
+    set_pcxxheader("LoadTestPch.h")
+    add_headerfiles("**.h")
+    add_files("**.cpp")
+    add_deps(
+        "CommonLib",
+        "AdminProtocol",
+        "TiltedConnect",
+        "SkyrimEncoding")
+    add_packages(
+        "tiltedcore",
+        "spdlog",
+        "hopscotch-map",
+        "glm",
+        "gamenetworkingsockets")
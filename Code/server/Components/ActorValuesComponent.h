@@ -9,4 +9,6 @@
 struct ActorValuesComponent
 {
     ActorValues CurrentActorValues{};
+    // Set when CurrentActorValues change, cleared once the character's SpawnCacheComponent is rebuilt
+    bool IsDirtySpawnCache{false};
 };
@@ -17,7 +17,8 @@ struct CharacterComponent
         kIsWeaponDrawn = 1 << 3,
         kIsDragon = 1 << 4,
         kIsMount = 1 << 5,
-        kIsPlayerSummon = 1 << 6
+        kIsPlayerSummon = 1 << 6,
+        kIsDirtySpawnCache = 1 << 7
     };
 
     [[nodiscard]] bool IsDirtyFactions() const { return Flags & kIsDirtyFactions; }
@@ -27,6 +28,7 @@ struct CharacterComponent
     [[nodiscard]] bool IsDragon() const { return Flags & kIsDragon; }
     [[nodiscard]] bool IsMount() const { return Flags & kIsMount; }
     [[nodiscard]] bool IsPlayerSummon() const { return Flags & kIsPlayerSummon; }
+    [[nodiscard]] bool IsDirtySpawnCache() const { return Flags & kIsDirtySpawnCache; }
 
     void SetDirtyFactions(bool aSet)
     {
@@ -77,6 +79,14 @@ struct CharacterComponent
         else
             Flags &= ~kIsPlayerSummon;
     }
+    // Set when ChangeFlags, FaceTints or FactionsContent change
+    void SetDirtySpawnCache(bool aSet)
+    {
+        if (aSet)
+            Flags |= kIsDirtySpawnCache;
+        else
+            Flags &= ~kIsDirtySpawnCache;
+    }
 
     uint32_t ChangeFlags{0};
     String SaveBuffer{};
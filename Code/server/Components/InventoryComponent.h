@@ -4,9 +4,11 @@
 #error Include Components.h instead
 #endif
 
-#include <Structs/Inventory.h>
+#include <Structs/IndexedInventory.h>
 
 struct InventoryComponent
 {
-    Inventory Content{};
+    IndexedInventory Content{};
+    // Set when Content changes, cleared once the character's SpawnCacheComponent is rebuilt
+    bool IsDirtySpawnCache{false};
 };
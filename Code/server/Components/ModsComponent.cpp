@@ -44,3 +44,29 @@ bool ModsComponent::IsInstalled(const String& acpFilename) const noexcept
 
     return it != m_serverMods.end();
 }
+
+bool ModsComponent::GetFilename(uint32_t aId, String& aFilename, bool& aIsLite) const noexcept
+{
+    // Standard and lite ids come from the same seed, an id is in one list at most
+    for (const auto& [filename, entry] : m_standardMods)
+    {
+        if (entry.id == aId)
+        {
+            aFilename = filename;
+            aIsLite = false;
+            return true;
+        }
+    }
+
+    for (const auto& [filename, entry] : m_liteMods)
+    {
+        if (entry.id == aId)
+        {
+            aFilename = filename;
+            aIsLite = true;
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -27,6 +27,8 @@ struct ModsComponent
     const auto& GetServerMods() const noexcept { return m_serverMods; }
 
     bool IsInstalled(const String& acpFileName) const noexcept;
+    // Reverse of AddStandard and AddLite
+    bool GetFilename(uint32_t aId, String& aFilename, bool& aIsLite) const noexcept;
 
     using TModList = TiltedPhoques::Map<String, Entry>;
 
@@ -0,0 +1,12 @@
+#pragma once
+
+#ifndef TP_INTERNAL_COMPONENTS_GUARD
+#error Include Components.h instead
+#endif
+
+struct SpawnCacheComponent
+{
+    // The character's CharacterSpawnRequest::SerializeContent, rebuilt when empty or when one of the
+    // character, inventory or actor values components is flagged dirty
+    Vector<uint8_t> Content{};
+};
@@ -1 +1,37 @@
 #include "Cell.h"
+
+namespace Game
+{
+namespace
+{
+template <class T> void SwapRemove(Vector<T>& aVector, const T& acValue) noexcept
+{
+    const auto itor = std::find(std::begin(aVector), std::end(aVector), acValue);
+    if (itor == std::end(aVector))
+        return;
+
+    *itor = aVector.back();
+    aVector.pop_back();
+}
+} // namespace
+
+void Cell::AddEntity(entt::entity aEntity) noexcept
+{
+    Entities.push_back(aEntity);
+}
+
+void Cell::RemoveEntity(entt::entity aEntity) noexcept
+{
+    SwapRemove(Entities, aEntity);
+}
+
+void Cell::AddPlayer(Player* apPlayer) noexcept
+{
+    Players.push_back(apPlayer);
+}
+
+void Cell::RemovePlayer(Player* apPlayer) noexcept
+{
+    SwapRemove(Players, apPlayer);
+}
+} // namespace Game
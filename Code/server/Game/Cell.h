@@ -1,5 +1,22 @@
 #pragma once
 
+struct Player;
+
+namespace Game
+{
+/**
+ * @brief Membership of a single grid cell (or of a whole interior cell).
+ */
 struct Cell
 {
+    void AddEntity(entt::entity aEntity) noexcept;
+    void RemoveEntity(entt::entity aEntity) noexcept;
+    void AddPlayer(Player* apPlayer) noexcept;
+    void RemovePlayer(Player* apPlayer) noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept { return Entities.empty() && Players.empty(); }
+
+    Vector<entt::entity> Entities;
+    Vector<Player*> Players;
 };
+} // namespace Game
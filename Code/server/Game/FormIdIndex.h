@@ -0,0 +1,53 @@
+#pragma once
+
+#include <Structs/GameId.h>
+
+#include <optional>
+
+/**
+ * @brief Entities tracking each game form, so a form is found without scanning every entity.
+ *
+ * Forms are expected to be tracked by a single entity, but nothing prevents duplicates.
+ */
+template <class TEntity> struct FormIdIndex
+{
+    void Add(const GameId& acId, TEntity aEntity) noexcept { m_entities[acId].push_back(aEntity); }
+
+    void Remove(const GameId& acId, TEntity aEntity) noexcept
+    {
+        auto itor = m_entities.find(acId);
+        if (itor == std::end(m_entities))
+            return;
+
+        auto& entities = itor.value();
+        std::erase(entities, aEntity);
+
+        if (entities.empty())
+            m_entities.erase(itor);
+    }
+
+    /**
+     * @brief Returns the first entity tracking the form that acPredicate accepts.
+     *
+     * @param acPredicate bool(TEntity)
+     */
+    template <class T> [[nodiscard]] std::optional<TEntity> Find(const GameId& acId, const T& acPredicate) const noexcept
+    {
+        const auto itor = m_entities.find(acId);
+        if (itor == std::end(m_entities))
+            return std::nullopt;
+
+        for (const auto entity : itor->second)
+        {
+            if (acPredicate(entity))
+                return entity;
+        }
+
+        return std::nullopt;
+    }
+
+    [[nodiscard]] size_t Size() const noexcept { return m_entities.size(); }
+
+private:
+    TiltedPhoques::Map<GameId, TiltedPhoques::Vector<TEntity>> m_entities;
+};
@@ -1 +1,185 @@
 #include "Map.h"
+
+namespace Game
+{
+void Map::OnCellConstruct(entt::registry& aRegistry, entt::entity aEntity) noexcept
+{
+    OnCellUpdate(aRegistry, aEntity);
+}
+
+void Map::OnCellUpdate(entt::registry& aRegistry, entt::entity aEntity) noexcept
+{
+    const auto& cellIdComponent = aRegistry.get<CellIdComponent>(aEntity);
+
+    bool isDragon = false;
+    if (const auto* pCharacterComponent = aRegistry.try_get<CharacterComponent>(aEntity))
+        isDragon = pCharacterComponent->IsDragon();
+
+    UpdateEntity(aEntity, cellIdComponent, isDragon);
+}
+
+void Map::OnCellDestroy(entt::registry&, entt::entity aEntity) noexcept
+{
+    RemoveEntity(aEntity);
+}
+
+void Map::UpdateEntity(entt::entity aEntity, const CellIdComponent& acCell, bool aIsDragon) noexcept
+{
+    const Location location{acCell.Cell, acCell.WorldSpaceId, acCell.CenterCoords, aIsDragon};
+
+    auto itor = m_entities.find(aEntity);
+    if (itor != std::end(m_entities))
+    {
+        if (itor->second == location)
+            return;
+
+        const Location previous = itor->second;
+        itor.value() = location;
+
+        Unlink(aEntity, previous);
+    }
+    else
+    {
+        m_entities.emplace(aEntity, location);
+    }
+
+    Link(aEntity, location);
+}
+
+void Map::RemoveEntity(entt::entity aEntity) noexcept
+{
+    const auto itor = m_entities.find(aEntity);
+    if (itor == std::end(m_entities))
+        return;
+
+    const Location previous = itor->second;
+    m_entities.erase(itor);
+
+    Unlink(aEntity, previous);
+}
+
+void Map::UpdatePlayer(Player* apPlayer, const CellIdComponent& acCell) noexcept
+{
+    const Location location{acCell.Cell, acCell.WorldSpaceId, acCell.CenterCoords, false};
+
+    auto itor = m_players.find(apPlayer);
+    if (itor != std::end(m_players))
+    {
+        if (itor->second == location)
+            return;
+
+        const Location previous = itor->second;
+        itor.value() = location;
+
+        Unlink(apPlayer, previous);
+    }
+    else
+    {
+        m_players.emplace(apPlayer, location);
+    }
+
+    Link(apPlayer, location);
+}
+
+void Map::RemovePlayer(Player* apPlayer) noexcept
+{
+    const auto itor = m_players.find(apPlayer);
+    if (itor == std::end(m_players))
+        return;
+
+    const Location previous = itor->second;
+    m_players.erase(itor);
+
+    Unlink(apPlayer, previous);
+}
+
+void Map::Link(entt::entity aEntity, const Location& acLocation) noexcept
+{
+    if (!acLocation.IsExterior())
+    {
+        m_interiors[acLocation.Cell].AddEntity(aEntity);
+        return;
+    }
+
+    auto& region = m_worldSpaces[acLocation.WorldSpaceId];
+    if (acLocation.IsDragon)
+        region.AddDragon(aEntity);
+    else
+        region.GetOrCreateCell(acLocation.CenterCoords).AddEntity(aEntity);
+}
+
+void Map::Unlink(entt::entity aEntity, const Location& acLocation) noexcept
+{
+    if (!acLocation.IsExterior())
+    {
+        if (auto itor = m_interiors.find(acLocation.Cell); itor != std::end(m_interiors))
+            itor.value().RemoveEntity(aEntity);
+
+        ReleaseInterior(acLocation.Cell);
+        return;
+    }
+
+    auto regionItor = m_worldSpaces.find(acLocation.WorldSpaceId);
+    if (regionItor == std::end(m_worldSpaces))
+        return;
+
+    auto& region = regionItor.value();
+    if (acLocation.IsDragon)
+    {
+        region.RemoveDragon(aEntity);
+    }
+    else if (auto* pCell = region.FindCell(acLocation.CenterCoords))
+    {
+        pCell->RemoveEntity(aEntity);
+        region.ReleaseCell(acLocation.CenterCoords);
+    }
+
+    ReleaseRegion(acLocation.WorldSpaceId);
+}
+
+void Map::Link(Player* apPlayer, const Location& acLocation) noexcept
+{
+    m_interiors[acLocation.Cell].AddPlayer(apPlayer);
+
+    if (acLocation.IsExterior())
+        m_worldSpaces[acLocation.WorldSpaceId].GetOrCreateCell(acLocation.CenterCoords).AddPlayer(apPlayer);
+}
+
+void Map::Unlink(Player* apPlayer, const Location& acLocation) noexcept
+{
+    if (auto itor = m_interiors.find(acLocation.Cell); itor != std::end(m_interiors))
+        itor.value().RemovePlayer(apPlayer);
+
+    ReleaseInterior(acLocation.Cell);
+
+    if (!acLocation.IsExterior())
+        return;
+
+    auto regionItor = m_worldSpaces.find(acLocation.WorldSpaceId);
+    if (regionItor == std::end(m_worldSpaces))
+        return;
+
+    auto& region = regionItor.value();
+    if (auto* pCell = region.FindCell(acLocation.CenterCoords))
+    {
+        pCell->RemovePlayer(apPlayer);
+        region.ReleaseCell(acLocation.CenterCoords);
+    }
+
+    ReleaseRegion(acLocation.WorldSpaceId);
+}
+
+void Map::ReleaseInterior(const GameId& acCell) noexcept
+{
+    const auto itor = m_interiors.find(acCell);
+    if (itor != std::end(m_interiors) && itor->second.IsEmpty())
+        m_interiors.erase(itor);
+}
+
+void Map::ReleaseRegion(const GameId& acWorldSpaceId) noexcept
+{
+    const auto itor = m_worldSpaces.find(acWorldSpaceId);
+    if (itor != std::end(m_worldSpaces) && itor->second.IsEmpty())
+        m_worldSpaces.erase(itor);
+}
+} // namespace Game
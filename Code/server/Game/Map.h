@@ -1 +1,127 @@
 #pragma once
+
+#include "Region.h"
+
+struct Player;
+
+namespace Game
+{
+/**
+ * @brief Interest management, tracks which entities and players live in which cells.
+ *
+ * Exterior cells are bucketed per worldspace in a hashed grid, interior cells are a single bucket each.
+ * Range queries mirror CellIdComponent::IsInRange but only visit the neighbouring cells.
+ */
+struct Map
+{
+    Map() noexcept = default;
+    ~Map() noexcept = default;
+
+    TP_NOCOPYMOVE(Map);
+
+    // entt signal handlers for CellIdComponent
+    void OnCellConstruct(entt::registry& aRegistry, entt::entity aEntity) noexcept;
+    void OnCellUpdate(entt::registry& aRegistry, entt::entity aEntity) noexcept;
+    void OnCellDestroy(entt::registry& aRegistry, entt::entity aEntity) noexcept;
+
+    void UpdateEntity(entt::entity aEntity, const CellIdComponent& acCell, bool aIsDragon) noexcept;
+    void RemoveEntity(entt::entity aEntity) noexcept;
+    void UpdatePlayer(Player* apPlayer, const CellIdComponent& acCell) noexcept;
+    void RemovePlayer(Player* apPlayer) noexcept;
+
+    /**
+     * @brief Visits every entity a player located in acObserver can see.
+     */
+    template <class T> void ForEachEntityInRange(const CellIdComponent& acObserver, const T& acFunctor) const noexcept;
+    /**
+     * @brief Visits every player that can see an entity located in acOrigin.
+     */
+    template <class T> void ForEachPlayerInRange(const CellIdComponent& acOrigin, bool aIsDragon, const T& acFunctor) const noexcept;
+
+private:
+    struct Location
+    {
+        GameId Cell{};
+        GameId WorldSpaceId{};
+        GridCellCoords CenterCoords{};
+        bool IsDragon{false};
+
+        [[nodiscard]] bool IsExterior() const noexcept { return static_cast<bool>(WorldSpaceId); }
+        [[nodiscard]] bool operator==(const Location& acRhs) const noexcept
+        {
+            return Cell == acRhs.Cell && WorldSpaceId == acRhs.WorldSpaceId && CenterCoords == acRhs.CenterCoords && IsDragon == acRhs.IsDragon;
+        }
+    };
+
+    void Link(entt::entity aEntity, const Location& acLocation) noexcept;
+    void Unlink(entt::entity aEntity, const Location& acLocation) noexcept;
+    void Link(Player* apPlayer, const Location& acLocation) noexcept;
+    void Unlink(Player* apPlayer, const Location& acLocation) noexcept;
+    void ReleaseInterior(const GameId& acCell) noexcept;
+    void ReleaseRegion(const GameId& acWorldSpaceId) noexcept;
+
+    static constexpr int32_t kRadius = GridCellCoords::m_gridsToLoad / 2;
+    static constexpr int32_t kDragonRadius = GridCellCoords::m_gridsToLoadIfDragon / 2;
+
+    // Interior entities, and every player keyed by its current cell
+    TiltedPhoques::Map<GameId, Cell> m_interiors;
+    TiltedPhoques::Map<GameId, Region> m_worldSpaces;
+    TiltedPhoques::Map<entt::entity, Location> m_entities;
+    TiltedPhoques::Map<Player*, Location> m_players;
+};
+
+template <class T> void Map::ForEachEntityInRange(const CellIdComponent& acObserver, const T& acFunctor) const noexcept
+{
+    if (const auto itor = m_interiors.find(acObserver.Cell); itor != std::end(m_interiors))
+    {
+        for (const auto entity : itor->second.Entities)
+            acFunctor(entity);
+    }
+
+    if (!acObserver.WorldSpaceId)
+        return;
+
+    const auto regionItor = m_worldSpaces.find(acObserver.WorldSpaceId);
+    if (regionItor == std::end(m_worldSpaces))
+        return;
+
+    const Region& region = regionItor->second;
+
+    region.ForEachCellInRadius(acObserver.CenterCoords, kRadius, [&acFunctor](const Cell& acCell) {
+        for (const auto entity : acCell.Entities)
+            acFunctor(entity);
+    });
+
+    for (const auto entity : region.GetDragons())
+    {
+        const auto locationItor = m_entities.find(entity);
+        if (locationItor != std::end(m_entities) &&
+            GridCellCoords::IsCellInGridCell(acObserver.CenterCoords, locationItor->second.CenterCoords, true))
+            acFunctor(entity);
+    }
+}
+
+template <class T>
+void Map::ForEachPlayerInRange(const CellIdComponent& acOrigin, bool aIsDragon, const T& acFunctor) const noexcept
+{
+    if (acOrigin.IsInInteriorCell())
+    {
+        if (const auto itor = m_interiors.find(acOrigin.Cell); itor != std::end(m_interiors))
+        {
+            for (auto* pPlayer : itor->second.Players)
+                acFunctor(pPlayer);
+        }
+
+        return;
+    }
+
+    const auto regionItor = m_worldSpaces.find(acOrigin.WorldSpaceId);
+    if (regionItor == std::end(m_worldSpaces))
+        return;
+
+    regionItor->second.ForEachCellInRadius(acOrigin.CenterCoords, aIsDragon ? kDragonRadius : kRadius, [&acFunctor](const Cell& acCell) {
+        for (auto* pPlayer : acCell.Players)
+            acFunctor(pPlayer);
+    });
+}
+} // namespace Game
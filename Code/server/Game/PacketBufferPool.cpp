@@ -0,0 +1,96 @@
+#include "PacketBufferPool.h"
+
+#include <bit>
+
+#include <spdlog/spdlog.h>
+
+namespace
+{
+std::atomic<uint64_t> s_serializations{0};
+std::atomic<uint64_t> s_allocations{0};
+std::atomic<uint64_t> s_allocatedBytes{0};
+std::atomic<uint64_t> s_regrows{0};
+} // namespace
+
+PacketBufferPool& PacketBufferPool::Get() noexcept
+{
+    static thread_local PacketBufferPool s_pool;
+    return s_pool;
+}
+
+PacketBufferPool::Stats PacketBufferPool::GetStats() noexcept
+{
+    Stats stats{};
+    stats.Serializations = s_serializations.load(std::memory_order_relaxed);
+    stats.Allocations = s_allocations.load(std::memory_order_relaxed);
+    stats.AllocatedBytes = s_allocatedBytes.load(std::memory_order_relaxed);
+    stats.Regrows = s_regrows.load(std::memory_order_relaxed);
+    return stats;
+}
+
+PacketBufferPool::Slot* PacketBufferPool::Acquire(size_t aCapacity) noexcept
+{
+    s_serializations.fetch_add(1, std::memory_order_relaxed);
+
+    // Prefer the smallest free buffer that is already big enough, otherwise grow the biggest free one.
+    Slot* pBestFit = nullptr;
+    Slot* pLargest = nullptr;
+    for (size_t i = 0; i < kRingSize; ++i)
+    {
+        Slot& slot = m_slots[(m_nextSlot + i) % kRingSize];
+        if (slot.InUse)
+            continue;
+
+        const size_t cSize = slot.Data.GetSize();
+        if (cSize >= aCapacity && (!pBestFit || cSize < pBestFit->Data.GetSize()))
+            pBestFit = &slot;
+        if (!pLargest || cSize > pLargest->Data.GetSize())
+            pLargest = &slot;
+    }
+
+    m_nextSlot = (m_nextSlot + 1) % kRingSize;
+
+    Slot* pSlot = pBestFit ? pBestFit : pLargest;
+    if (!pSlot)
+    {
+        // Reusing a leased buffer would overwrite a packet that was not sent yet
+        spdlog::warn("PacketBufferPool: all {} buffers are in use, serializing into a temporary buffer", kRingSize);
+
+        pSlot = new Slot;
+        pSlot->IsTemporary = true;
+    }
+
+    if (pSlot->Data.GetSize() < aCapacity)
+        Grow(*pSlot, aCapacity);
+
+    pSlot->InUse = true;
+    return pSlot;
+}
+
+void PacketBufferPool::Grow(Slot& aSlot, size_t aCapacity) noexcept
+{
+    if (aSlot.Data.GetSize() != 0)
+        s_regrows.fetch_add(1, std::memory_order_relaxed);
+
+    aCapacity = std::min(aCapacity, kMaxBufferSize);
+
+    aSlot.Data.Resize(aCapacity);
+
+    s_allocations.fetch_add(1, std::memory_order_relaxed);
+    s_allocatedBytes.fetch_add(aCapacity, std::memory_order_relaxed);
+}
+
+void PacketBufferPool::Commit(uint32_t aKey, size_t aSize) noexcept
+{
+    if (aKey < kKeyCount && aSize > m_highWater[aKey])
+        m_highWater[aKey] = static_cast<uint32_t>(aSize);
+}
+
+size_t PacketBufferPool::GetTargetCapacity(uint32_t aKey) const noexcept
+{
+    const size_t cHighWater = aKey < kKeyCount ? m_highWater[aKey] : kMaxBufferSize;
+
+    // Keep twice the largest size seen as headroom, see the truncation check in Write().
+    const size_t cCapacity = std::bit_ceil(std::max<size_t>(cHighWater * 2, kMinBufferSize));
+    return std::min(cCapacity, kMaxBufferSize);
+}
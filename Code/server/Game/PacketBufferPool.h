@@ -0,0 +1,163 @@
+#pragma once
+
+#include <TiltedCore/Buffer.hpp>
+
+using TiltedPhoques::Buffer;
+
+/**
+ * @brief Per-thread ring of reusable buffers used to serialize outgoing packets.
+ *
+ * Buffers are sized from the high-water mark observed for each opcode, so the send path
+ * stops allocating once every message type has been seen a few times.
+ */
+struct PacketBufferPool
+{
+    // Legacy per-message buffer size, also the largest packet we are willing to build.
+    static constexpr size_t kMaxBufferSize = 1 << 20;
+    static constexpr size_t kMinBufferSize = 1 << 16;
+    static constexpr size_t kRingSize = 8;
+    // Server opcodes use [0, 256), admin opcodes are offset by 256.
+    static constexpr size_t kKeyCount = 512;
+    static constexpr uint32_t kAdminKeyOffset = 256;
+
+    struct Stats
+    {
+        uint64_t Serializations;
+        uint64_t Allocations;
+        uint64_t AllocatedBytes;
+        uint64_t Regrows;
+
+        [[nodiscard]] uint64_t GetAllocationsAvoided() const noexcept
+        {
+            return Serializations > Allocations ? Serializations - Allocations : 0;
+        }
+        [[nodiscard]] uint64_t GetBytesAvoided() const noexcept
+        {
+            const uint64_t cLegacyBytes = Serializations * kMaxBufferSize;
+            return cLegacyBytes > AllocatedBytes ? cLegacyBytes - AllocatedBytes : 0;
+        }
+    };
+
+private:
+    struct Slot
+    {
+        Buffer Data{};
+        bool InUse{false};
+        // Allocated because every pooled buffer was leased, freed with the lease
+        bool IsTemporary{false};
+    };
+
+public:
+    /**
+     * @brief A serialized packet, the pooled buffer is handed back when the lease dies.
+     *
+     * The payload is immutable once built, it can be sent to any number of connections.
+     */
+    struct Lease
+    {
+        Lease() noexcept = default;
+        Lease(Slot* apSlot, uint32_t aSize) noexcept
+            : m_pSlot(apSlot)
+            , m_size(aSize)
+        {
+        }
+        ~Lease() noexcept { Release(); }
+
+        Lease(Lease&& aRhs) noexcept
+            : m_pSlot(std::exchange(aRhs.m_pSlot, nullptr))
+            , m_size(std::exchange(aRhs.m_size, 0))
+        {
+        }
+        Lease& operator=(Lease&& aRhs) noexcept
+        {
+            Release();
+            m_pSlot = std::exchange(aRhs.m_pSlot, nullptr);
+            m_size = std::exchange(aRhs.m_size, 0);
+            return *this;
+        }
+
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+
+        explicit operator bool() const noexcept { return m_pSlot != nullptr; }
+
+        // Includes the reserved header byte.
+        [[nodiscard]] uint8_t* GetData() const noexcept { return m_pSlot->Data.GetWriteData(); }
+        [[nodiscard]] uint32_t GetSize() const noexcept { return m_size; }
+
+    private:
+        void Release() noexcept
+        {
+            if (m_pSlot && m_pSlot->IsTemporary)
+                delete m_pSlot;
+            else if (m_pSlot)
+                m_pSlot->InUse = false;
+            m_pSlot = nullptr;
+        }
+
+        Slot* m_pSlot{nullptr};
+        uint32_t m_size{0};
+    };
+
+    PacketBufferPool() noexcept = default;
+    ~PacketBufferPool() noexcept = default;
+
+    TP_NOCOPYMOVE(PacketBufferPool);
+
+    /**
+     * @brief Returns the pool of the calling thread.
+     */
+    [[nodiscard]] static PacketBufferPool& Get() noexcept;
+    /**
+     * @brief Returns counters aggregated over every thread's pool.
+     */
+    [[nodiscard]] static Stats GetStats() noexcept;
+
+    /**
+     * @brief Serializes a packet into a pooled buffer.
+     *
+     * The first byte is reserved for the packet header.
+     *
+     * @param aKey opcode slot used to track the high-water mark.
+     * @param acSerializer void(Buffer::Writer&)
+     */
+    template <class TSerializer> [[nodiscard]] Lease Write(uint32_t aKey, const TSerializer& acSerializer) noexcept;
+
+private:
+    Slot* Acquire(size_t aCapacity) noexcept;
+    void Grow(Slot& aSlot, size_t aCapacity) noexcept;
+    void Commit(uint32_t aKey, size_t aSize) noexcept;
+    [[nodiscard]] size_t GetTargetCapacity(uint32_t aKey) const noexcept;
+
+    Slot m_slots[kRingSize];
+    size_t m_nextSlot{0};
+    uint32_t m_highWater[kKeyCount]{};
+};
+
+template <class TSerializer>
+PacketBufferPool::Lease PacketBufferPool::Write(uint32_t aKey, const TSerializer& acSerializer) noexcept
+{
+    Slot* pSlot = Acquire(GetTargetCapacity(aKey));
+
+    while (true)
+    {
+        Buffer::Writer writer(&pSlot->Data);
+        writer.WriteBits(0, 8); // Skip the first byte as it is used by packet
+
+        acSerializer(writer);
+
+        const size_t cSize = writer.Size();
+        const size_t cCapacity = pSlot->Data.GetSize();
+
+        // Writers silently drop writes that do not fit, so a message that ate into the
+        // headroom may have been truncated; serialize it again in a bigger buffer.
+        if (cSize > cCapacity / 2 && cCapacity < kMaxBufferSize)
+        {
+            Grow(*pSlot, cCapacity * 2);
+            continue;
+        }
+
+        Commit(aKey, cSize);
+        return Lease(pSlot, static_cast<uint32_t>(cSize));
+    }
+}
@@ -1,5 +1,6 @@
 #include "Player.h"
 #include <GameServer.h>
+#include <ChatSanitizer.h>
 
 static uint32_t GenerateId()
 {
@@ -24,9 +25,12 @@ Player::Player(Player&& aRhs) noexcept
     , m_discordId{std::exchange(aRhs.m_discordId, 0)}
     , m_endpoint{std::exchange(aRhs.m_endpoint, {})}
     , m_username{std::exchange(aRhs.m_username, {})}
+    , m_chatName{std::exchange(aRhs.m_chatName, {})}
     , m_party{std::exchange(aRhs.m_party, {})}
     , m_questLog{std::exchange(aRhs.m_questLog, {})}
     , m_cell{std::exchange(aRhs.m_cell, {})}
+    , m_movementBaselines{std::exchange(aRhs.m_movementBaselines, {})}
+    , m_pendingSpawns{std::exchange(aRhs.m_pendingSpawns, {})}
 {
 }
 
@@ -63,6 +67,7 @@ void Player::SetEndpoint(String aEndpoint) noexcept
 void Player::SetUsername(String aUsername) noexcept
 {
     m_username = std::move(aUsername);
+    SanitizeChatText(m_username, m_chatName);
 }
 
 void Player::SetMods(Vector<String> aMods) noexcept
@@ -93,6 +98,9 @@ void Player::SetLevel(uint16_t aLevel) noexcept
 void Player::SetCellComponent(const CellIdComponent& aCellComponent) noexcept
 {
     m_cell = aCellComponent;
+
+    if (auto* pServer = GameServer::Get())
+        pServer->GetWorld().GetMap().UpdatePlayer(this, m_cell);
 }
 
 void Player::Send(const ServerMessage& acServerMessage) const
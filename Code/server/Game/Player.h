@@ -3,6 +3,11 @@
 struct ServerMessage;
 struct Player
 {
+    // References this player holds a movement baseline for, mapped to the last tick they were in range
+    using MovementBaselines = TiltedPhoques::Map<uint32_t, uint64_t>;
+    // Characters waiting to be streamed to this player after a cell change, oldest first
+    using PendingSpawns = Vector<entt::entity>;
+
     Player(ConnectionId_t aConnectionId);
     ~Player() noexcept = default;
 
@@ -16,7 +21,10 @@ struct Player
     [[nodiscard]] ConnectionId_t GetConnectionId() const noexcept { return m_connectionId; }
     [[nodiscard]] std::optional<entt::entity> GetCharacter() const noexcept { return m_character; }
     [[nodiscard]] PartyComponent& GetParty() noexcept { return m_party; }
+    [[nodiscard]] const PartyComponent& GetParty() const noexcept { return m_party; }
     [[nodiscard]] const String& GetUsername() const noexcept { return m_username; }
+    // The username stripped of markup, ready to be shown in chat
+    [[nodiscard]] const String& GetChatName() const noexcept { return m_chatName; }
     [[nodiscard]] const String& GetEndPoint() const noexcept { return m_endpoint; }
     [[nodiscard]] const uint64_t GetDiscordId() const noexcept { return m_discordId; }
     [[nodiscard]] const uint32_t GetStringCacheId() const noexcept { return m_stringCacheId; }
@@ -26,6 +34,8 @@ struct Player
     [[nodiscard]] const CellIdComponent& GetCellComponent() const noexcept;
     [[nodiscard]] QuestLogComponent& GetQuestLogComponent() noexcept;
     [[nodiscard]] const QuestLogComponent& GetQuestLogComponent() const noexcept;
+    [[nodiscard]] MovementBaselines& GetMovementBaselines() noexcept { return m_movementBaselines; }
+    [[nodiscard]] PendingSpawns& GetPendingSpawns() noexcept { return m_pendingSpawns; }
 
     void SetDiscordId(uint64_t aDiscordId) noexcept;
     void SetEndpoint(String aEndpoint) noexcept;
@@ -50,9 +60,12 @@ private:
     uint64_t m_discordId{0};
     String m_endpoint;
     String m_username;
+    String m_chatName;
     PartyComponent m_party;
     QuestLogComponent m_questLog;
     CellIdComponent m_cell;
+    MovementBaselines m_movementBaselines;
+    PendingSpawns m_pendingSpawns;
     uint32_t m_stringCacheId{0};
     uint16_t m_level{0};
 };
@@ -1,5 +1,6 @@
 #include "PlayerManager.h"
 #include "Player.h"
+#include <GameServer.h>
 
 static PlayerManager* s_pInstance = nullptr;
 
@@ -32,7 +33,12 @@ Player* PlayerManager::Create(ConnectionId_t aConnectionId) noexcept
         const auto [insertedItor, inserted] = m_players.emplace(aConnectionId, MakeUnique<Player>(aConnectionId));
         if (inserted)
         {
-            return insertedItor.value().get();
+            Player* pPlayer = insertedItor.value().get();
+
+            if (auto* pServer = GameServer::Get())
+                pServer->GetWorld().GetMap().UpdatePlayer(pPlayer, pPlayer->GetCellComponent());
+
+            return pPlayer;
         }
     }
 
@@ -41,6 +47,9 @@ Player* PlayerManager::Create(ConnectionId_t aConnectionId) noexcept
 
 void PlayerManager::Remove(Player* apPlayer) noexcept
 {
+    if (auto* pServer = GameServer::Get())
+        pServer->GetWorld().GetMap().RemovePlayer(apPlayer);
+
     m_players.erase(apPlayer->GetConnectionId());
 }
 
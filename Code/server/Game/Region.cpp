@@ -1 +1,49 @@
 #include "Region.h"
+
+namespace Game
+{
+Cell& Region::GetOrCreateCell(const GridCellCoords& acCoords) noexcept
+{
+    return m_cells[ToKey(acCoords.X, acCoords.Y)];
+}
+
+Cell* Region::FindCell(const GridCellCoords& acCoords) noexcept
+{
+    const auto itor = m_cells.find(ToKey(acCoords.X, acCoords.Y));
+    if (itor == std::end(m_cells))
+        return nullptr;
+
+    return &itor.value();
+}
+
+const Cell* Region::FindCell(const GridCellCoords& acCoords) const noexcept
+{
+    const auto itor = m_cells.find(ToKey(acCoords.X, acCoords.Y));
+    if (itor == std::end(m_cells))
+        return nullptr;
+
+    return &itor->second;
+}
+
+void Region::ReleaseCell(const GridCellCoords& acCoords) noexcept
+{
+    const auto itor = m_cells.find(ToKey(acCoords.X, acCoords.Y));
+    if (itor != std::end(m_cells) && itor->second.IsEmpty())
+        m_cells.erase(itor);
+}
+
+void Region::AddDragon(entt::entity aEntity) noexcept
+{
+    m_dragons.push_back(aEntity);
+}
+
+void Region::RemoveDragon(entt::entity aEntity) noexcept
+{
+    const auto itor = std::find(std::begin(m_dragons), std::end(m_dragons), aEntity);
+    if (itor == std::end(m_dragons))
+        return;
+
+    *itor = m_dragons.back();
+    m_dragons.pop_back();
+}
+} // namespace Game
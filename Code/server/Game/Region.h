@@ -1,10 +1,58 @@
 #pragma once
 
-struct Cell;
+#include "Cell.h"
 
+#include <Structs/GridCellCoords.h>
+
+namespace Game
+{
+/**
+ * @brief Hashed grid of the exterior cells of a worldspace.
+ */
 struct Region
 {
+    [[nodiscard]] Cell& GetOrCreateCell(const GridCellCoords& acCoords) noexcept;
+    [[nodiscard]] Cell* FindCell(const GridCellCoords& acCoords) noexcept;
+    [[nodiscard]] const Cell* FindCell(const GridCellCoords& acCoords) const noexcept;
+    // Drops the cell if nothing references it anymore
+    void ReleaseCell(const GridCellCoords& acCoords) noexcept;
+
+    void AddDragon(entt::entity aEntity) noexcept;
+    void RemoveDragon(entt::entity aEntity) noexcept;
+
+    [[nodiscard]] bool IsEmpty() const noexcept { return m_cells.empty() && m_dragons.empty(); }
+    [[nodiscard]] const Vector<entt::entity>& GetDragons() const noexcept { return m_dragons; }
+
+    /**
+     * @brief Visits every existing cell at most aRadius cells away on both axes.
+     */
+    template <class T> void ForEachCellInRadius(const GridCellCoords& acCenter, int32_t aRadius, const T& acFunctor) const noexcept
+    {
+        // Coordinates default to INT32_MAX, avoid overflowing while walking around them
+        const int64_t cMinX = static_cast<int64_t>(acCenter.X) - aRadius;
+        const int64_t cMaxX = static_cast<int64_t>(acCenter.X) + aRadius;
+        const int64_t cMinY = static_cast<int64_t>(acCenter.Y) - aRadius;
+        const int64_t cMaxY = static_cast<int64_t>(acCenter.Y) + aRadius;
+
+        for (int64_t x = cMinX; x <= cMaxX; ++x)
+        {
+            for (int64_t y = cMinY; y <= cMaxY; ++y)
+            {
+                const auto itor = m_cells.find(ToKey(x, y));
+                if (itor != std::end(m_cells))
+                    acFunctor(itor->second);
+            }
+        }
+    }
 
 private:
-    // Map<glm::ivec2, Cell> m_cells;
+    [[nodiscard]] static uint64_t ToKey(int64_t aX, int64_t aY) noexcept
+    {
+        return (static_cast<uint64_t>(static_cast<uint32_t>(aX)) << 32) | static_cast<uint32_t>(aY);
+    }
+
+    TiltedPhoques::Map<uint64_t, Cell> m_cells;
+    // Dragons are seen from much further away, they are few enough to be checked individually
+    Vector<entt::entity> m_dragons;
 };
+} // namespace Game
@@ -0,0 +1,88 @@
+#include "SnapshotBuilder.h"
+
+#include <Messages/ServerReferencesMoveRequest.h>
+
+#include <spdlog/spdlog.h>
+
+namespace
+{
+constexpr size_t kScratchSize = 1 << 12;
+// Twice the largest update so a write that did not fit is always detected by the headroom check
+constexpr size_t kMaxScratchSize = ServerReferencesMoveRequest::kMaxUpdateSize * 2;
+} // namespace
+
+SnapshotBuilder::SnapshotBuilder() noexcept
+    : m_scratch(kScratchSize)
+{
+}
+
+void SnapshotBuilder::BeginTick() noexcept
+{
+    ++m_tick;
+    m_data.clear();
+}
+
+void SnapshotBuilder::EndTick() noexcept
+{
+    for (auto itor = std::begin(m_entries); itor != std::end(m_entries);)
+    {
+        if (itor->second.Tick != m_tick)
+        {
+            itor = m_entries.erase(itor);
+            continue;
+        }
+
+        auto& entry = itor.value();
+        if (entry.HasOverflowed)
+        {
+            // Only some recipients may have received the update, they all start over from a keyframe
+            entry.IsKnown = false;
+            entry.HasNext = false;
+            entry.HasOverflowed = false;
+        }
+        else if (entry.HasNext)
+        {
+            // Swap to keep the variable vectors' storage around for the next tick
+            std::swap(entry.Broadcast, entry.Next);
+            entry.IsKnown = true;
+            entry.HasNext = false;
+        }
+
+        ++itor;
+    }
+}
+
+SnapshotBuilder::Slice SnapshotBuilder::Encode(const MovementDelta& acMovement, const Vector<ActionEvent>& acActionEvents) noexcept
+{
+    while (true)
+    {
+        Buffer::Writer writer(&m_scratch);
+        ReferenceDelta::Serialize(writer, acMovement, acActionEvents);
+
+        const size_t cSize = writer.Size();
+        const size_t cCapacity = m_scratch.GetSize();
+
+        // Writers silently drop writes that do not fit, same headroom check as PacketBufferPool
+        if (cSize > cCapacity / 2)
+        {
+            if (cCapacity < kMaxScratchSize)
+            {
+                m_scratch.Resize(std::min(cCapacity * 2, kMaxScratchSize));
+                continue;
+            }
+
+            spdlog::warn("Dropped a movement update with {} action events larger than {} bytes", acActionEvents.size(),
+                         ServerReferencesMoveRequest::kMaxUpdateSize);
+            return {};
+        }
+
+        Slice slice;
+        slice.Offset = static_cast<uint32_t>(m_data.size());
+        slice.Size = static_cast<uint32_t>(cSize);
+
+        const uint8_t* pData = m_scratch.GetWriteData();
+        m_data.insert(std::end(m_data), pData, pData + cSize);
+
+        return slice;
+    }
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <Structs/ReferenceDelta.h>
+
+#include <span>
+
+/**
+ * @brief Encodes movement updates once per tick and shares the bytes between recipients.
+ *
+ * Every player that has a baseline for a reference holds the same movement, the one last
+ * broadcast, so a reference needs at most two encodings per tick: a delta for players that
+ * already know it and a keyframe for players that just got it in range.
+ */
+struct SnapshotBuilder
+{
+    struct Slice
+    {
+        uint32_t Offset{0};
+        uint32_t Size{0};
+
+        explicit operator bool() const noexcept { return Size != 0; }
+    };
+
+    SnapshotBuilder() noexcept;
+    ~SnapshotBuilder() noexcept = default;
+
+    TP_NOCOPYMOVE(SnapshotBuilder);
+
+    /**
+     * @brief Drops the previous tick's encodings, slices from the previous tick become invalid.
+     */
+    void BeginTick() noexcept;
+    /**
+     * @brief Commits the movements sent during the tick as the new baselines.
+     *
+     * References no recipient had in range during the tick are forgotten, references whose update did not fit
+     * are sent as keyframes to every recipient on the next tick.
+     */
+    void EndTick() noexcept;
+
+    /**
+     * @brief Returns the update to send to a recipient, encoding it if no other recipient needed it yet.
+     *
+     * @param aIsKeyframe true if the recipient has no baseline for the reference.
+     * @param aHasChanged true if the reference moved since the last broadcast.
+     * @param acFill const Vector<ActionEvent>&(Movement&), fills the current movement and returns the actions to send.
+     * @return An empty slice if the recipient is up to date or if the update is too large to be sent.
+     */
+    template <class T> [[nodiscard]] Slice Get(uint32_t aServerId, bool aIsKeyframe, bool aHasChanged, const T& acFill) noexcept;
+
+    [[nodiscard]] std::span<const uint8_t> GetData(const Slice& acSlice) const noexcept
+    {
+        return {m_data.data() + acSlice.Offset, acSlice.Size};
+    }
+
+private:
+    struct Entry
+    {
+        // Movement held by every recipient that has a baseline for the reference
+        Movement Broadcast{};
+        Movement Next{};
+        uint64_t Tick{0};
+        Slice Keyframe{};
+        Slice Delta{};
+        bool IsKnown{false};
+        bool HasNext{false};
+        bool HasOverflowed{false};
+    };
+
+    Slice Encode(const MovementDelta& acMovement, const Vector<ActionEvent>& acActionEvents) noexcept;
+
+    uint64_t m_tick{0};
+    TiltedPhoques::Map<uint32_t, Entry> m_entries;
+    Vector<uint8_t> m_data;
+    Buffer m_scratch;
+    const Vector<ActionEvent> m_noActionEvents{};
+};
+
+template <class T> SnapshotBuilder::Slice SnapshotBuilder::Get(uint32_t aServerId, bool aIsKeyframe, bool aHasChanged, const T& acFill) noexcept
+{
+    auto itor = m_entries.try_emplace(aServerId).first;
+    auto& entry = itor.value();
+
+    if (entry.Tick != m_tick)
+    {
+        entry.Tick = m_tick;
+        entry.Keyframe = {};
+        entry.Delta = {};
+    }
+
+    // A recipient cannot have a baseline we never broadcast, a keyframe is always safe to apply
+    if (!entry.IsKnown)
+        aIsKeyframe = true;
+
+    if (!aIsKeyframe && !aHasChanged)
+        return {};
+
+    if (entry.HasOverflowed)
+        return {};
+
+    Slice& slice = aIsKeyframe ? entry.Keyframe : entry.Delta;
+    if (slice)
+        return slice;
+
+    // Recipients that already know the reference are not sent anything, the keyframe must hold the movement they
+    // have or the next delta would not apply to the same baseline for everyone
+    if (!aHasChanged && entry.IsKnown)
+    {
+        slice = Encode(MovementDelta::MakeKeyframe(entry.Broadcast), m_noActionEvents);
+        entry.HasOverflowed = !slice;
+        return slice;
+    }
+
+    const Vector<ActionEvent>& cActionEvents = acFill(entry.Next);
+
+    slice = Encode(aIsKeyframe ? MovementDelta::MakeKeyframe(entry.Next) : MovementDelta::Make(entry.Broadcast, entry.Next), cActionEvents);
+    entry.HasNext = static_cast<bool>(slice);
+    entry.HasOverflowed = !slice;
+
+    return slice;
+}
@@ -0,0 +1,100 @@
+#include "TickProfiler.h"
+
+#include <bit>
+
+void TickProfiler::Histogram::Add(uint64_t aMicroseconds) noexcept
+{
+    ++Count;
+    TotalMicroseconds += aMicroseconds;
+    MaxMicroseconds = std::max(MaxMicroseconds, aMicroseconds);
+
+    // Bucket 0 holds sub-microsecond samples, bucket i holds [2^(i-1), 2^i)
+    const size_t cBucket = std::min<size_t>(std::bit_width(aMicroseconds), kBucketCount - 1);
+    ++Buckets[cBucket];
+}
+
+uint64_t TickProfiler::Histogram::GetPercentile(double aPercentile) const noexcept
+{
+    if (Count == 0)
+        return 0;
+
+    const auto cTarget = static_cast<uint64_t>(std::ceil(aPercentile * static_cast<double>(Count)));
+
+    uint64_t seen = 0;
+    for (size_t i = 0; i < kBucketCount; ++i)
+    {
+        seen += Buckets[i];
+        if (seen >= cTarget && seen > 0)
+            return std::min(uint64_t(1) << i, MaxMicroseconds);
+    }
+
+    return MaxMicroseconds;
+}
+
+TickProfiler& TickProfiler::Get() noexcept
+{
+    static TickProfiler s_profiler;
+    return s_profiler;
+}
+
+uint32_t TickProfiler::Register(const String& acName) noexcept
+{
+    for (uint32_t i = 0; i < m_sections.size(); ++i)
+    {
+        if (m_sections[i].Name == acName)
+            return i;
+    }
+
+    auto& section = m_sections.emplace_back();
+    section.Name = acName;
+
+    return static_cast<uint32_t>(m_sections.size() - 1);
+}
+
+void TickProfiler::Record(uint32_t aSection, Clock::duration aDuration) noexcept
+{
+    if (aSection >= m_sections.size()) [[unlikely]]
+        return;
+
+    const auto cMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(aDuration).count();
+    m_sections[aSection].Current.Add(static_cast<uint64_t>(std::max<int64_t>(cMicroseconds, 0)));
+}
+
+void TickProfiler::Update(Clock::time_point aNow) noexcept
+{
+    if (m_windowStart == Clock::time_point{})
+        m_windowStart = aNow;
+
+    if (aNow - m_windowStart < kWindow)
+        return;
+
+    for (auto& section : m_sections)
+    {
+        section.Last = section.Current;
+        section.Current = {};
+    }
+
+    m_lastWindowDuration = aNow - m_windowStart;
+    m_windowStart = aNow;
+}
+
+Vector<TickProfiler::ReportEntry> TickProfiler::GetReport() const noexcept
+{
+    Vector<ReportEntry> report;
+
+    for (const auto& section : m_sections)
+    {
+        if (section.Last.Count > 0)
+            report.push_back({section.Name, section.Last});
+    }
+
+    std::sort(std::begin(report), std::end(report),
+              [](const ReportEntry& acLhs, const ReportEntry& acRhs) { return acLhs.Samples.TotalMicroseconds > acRhs.Samples.TotalMicroseconds; });
+
+    return report;
+}
+
+TickProfiler::Clock::duration TickProfiler::GetReportDuration() const noexcept
+{
+    return m_lastWindowDuration;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#define TICK_PROFILE_CONCAT_IMPL(a, b) a##b
+#define TICK_PROFILE_CONCAT(a, b) TICK_PROFILE_CONCAT_IMPL(a, b)
+
+/**
+ * Times the rest of the enclosing scope under the given section name.
+ */
+#define TICK_PROFILE_SCOPE(name)                                                                                       \
+    static const uint32_t TICK_PROFILE_CONCAT(s_tickProfileSection, __LINE__) = TickProfiler::Get().Register(name);   \
+    const TickProfiler::Scope TICK_PROFILE_CONCAT(tickProfileScope, __LINE__)(TICK_PROFILE_CONCAT(s_tickProfileSection, __LINE__))
+
+/**
+ * @brief Aggregates scoped timings of the game thread into rolling histograms.
+ *
+ * Samples are bucketed by powers of two microseconds. Reports cover the last complete window so
+ * they are not skewed by a window that just started.
+ */
+struct TickProfiler
+{
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t kBucketCount = 24;
+    static constexpr Clock::duration kWindow = std::chrono::seconds(10);
+
+    struct Histogram
+    {
+        uint64_t Count{0};
+        uint64_t TotalMicroseconds{0};
+        uint64_t MaxMicroseconds{0};
+        uint64_t Buckets[kBucketCount]{};
+
+        void Add(uint64_t aMicroseconds) noexcept;
+        /**
+         * @brief Returns the upper bound of the bucket holding the given percentile.
+         * @param aPercentile In the [0, 1] range.
+         */
+        [[nodiscard]] uint64_t GetPercentile(double aPercentile) const noexcept;
+    };
+
+    struct ReportEntry
+    {
+        String Name;
+        Histogram Samples;
+    };
+
+    struct Scope
+    {
+        explicit Scope(uint32_t aSection) noexcept
+            : m_section(aSection)
+            , m_start(Clock::now())
+        {
+        }
+        ~Scope() noexcept { TickProfiler::Get().Record(m_section, Clock::now() - m_start); }
+
+        TP_NOCOPYMOVE(Scope);
+
+    private:
+        uint32_t m_section;
+        Clock::time_point m_start;
+    };
+
+    TickProfiler() noexcept = default;
+    ~TickProfiler() noexcept = default;
+
+    TP_NOCOPYMOVE(TickProfiler);
+
+    /**
+     * @brief Returns the profiler of the game thread, it is not meant to be used from other threads.
+     */
+    [[nodiscard]] static TickProfiler& Get() noexcept;
+
+    /**
+     * @brief Returns the id of a section, registering it on first use.
+     */
+    [[nodiscard]] uint32_t Register(const String& acName) noexcept;
+    void Record(uint32_t aSection, Clock::duration aDuration) noexcept;
+    /**
+     * @brief Starts a new window once the current one is complete.
+     */
+    void Update(Clock::time_point aNow) noexcept;
+
+    /**
+     * @brief Returns the sections that were hit in the last complete window, most total time first.
+     */
+    [[nodiscard]] Vector<ReportEntry> GetReport() const noexcept;
+    [[nodiscard]] Clock::duration GetReportDuration() const noexcept;
+
+private:
+    struct Section
+    {
+        String Name;
+        Histogram Current;
+        Histogram Last;
+    };
+
+    Vector<Section> m_sections;
+    Clock::time_point m_windowStart{};
+    Clock::duration m_lastWindowDuration{};
+};
@@ -0,0 +1,43 @@
+#include "TickScheduler.h"
+#include "TickProfiler.h"
+
+void TickScheduler::SetTickRate(uint32_t aTickRate) noexcept
+{
+    BASE_ASSERT(aTickRate > 0, "TickScheduler: tick rate must be positive");
+
+    m_tickPeriod = std::chrono::duration_cast<Clock::duration>(std::chrono::seconds(1)) / std::max(aTickRate, 1u);
+}
+
+void TickScheduler::AddJob(const String& acName, Clock::duration aPeriod, Job aJob) noexcept
+{
+    m_jobs.push_back({aPeriod, Clock::time_point{}, std::move(aJob), TickProfiler::Get().Register(acName)});
+}
+
+bool TickScheduler::BeginTick(Clock::time_point aNow) noexcept
+{
+    if (aNow < m_nextTick)
+        return false;
+
+    // Keep a fixed cadence, but do not try to catch up on ticks lost to a stall
+    m_nextTick += m_tickPeriod;
+    if (m_nextTick <= aNow)
+        m_nextTick = aNow + m_tickPeriod;
+
+    return true;
+}
+
+void TickScheduler::RunJobs(Clock::time_point aNow) noexcept
+{
+    for (auto& job : m_jobs)
+    {
+        if (aNow < job.NextRun)
+            continue;
+
+        job.NextRun += job.Period;
+        if (job.NextRun <= aNow)
+            job.NextRun = aNow + job.Period;
+
+        const TickProfiler::Scope scope(job.ProfileSection);
+        job.Callback();
+    }
+}
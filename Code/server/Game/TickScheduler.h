@@ -0,0 +1,53 @@
+#pragma once
+
+/**
+ * @brief Paces the server tick at a fixed rate and runs periodic jobs from it.
+ *
+ * Jobs run at the end of a tick once their period has elapsed, so a job cannot run more often
+ * than the tick rate.
+ */
+struct TickScheduler
+{
+    using Clock = std::chrono::steady_clock;
+    using Job = std::function<void()>;
+
+    TickScheduler() noexcept = default;
+    ~TickScheduler() noexcept = default;
+
+    TP_NOCOPYMOVE(TickScheduler);
+
+    void SetTickRate(uint32_t aTickRate) noexcept;
+    [[nodiscard]] Clock::duration GetTickPeriod() const noexcept { return m_tickPeriod; }
+    /**
+     * @brief Returns when the next tick is due, the server can sleep until then.
+     */
+    [[nodiscard]] Clock::time_point GetNextTick() const noexcept { return m_nextTick; }
+
+    /**
+     * @brief Registers a job to run every aPeriod, for the lifetime of the server.
+     *
+     * @param acName Name the job's run time is reported under by the tick profiler.
+     */
+    void AddJob(const String& acName, Clock::duration aPeriod, Job aJob) noexcept;
+
+    /**
+     * @brief Starts a tick if one is due.
+     *
+     * @return true if the caller should run a tick.
+     */
+    [[nodiscard]] bool BeginTick(Clock::time_point aNow) noexcept;
+    void RunJobs(Clock::time_point aNow) noexcept;
+
+private:
+    struct Entry
+    {
+        Clock::duration Period;
+        Clock::time_point NextRun;
+        Job Callback;
+        uint32_t ProfileSection;
+    };
+
+    Clock::duration m_tickPeriod{std::chrono::milliseconds(1000) / 60};
+    Clock::time_point m_nextTick{};
+    Vector<Entry> m_jobs;
+};
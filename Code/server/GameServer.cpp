@@ -1,5 +1,7 @@
 ﻿#include <Components.h>
 #include <GameServer.h>
+#include <Game/PacketBufferPool.h>
+#include <Game/TickProfiler.h>
 #include <Packet.hpp>
 
 #include <Events/AdminPacketEvent.h>
@@ -17,6 +19,7 @@
 #include <Messages/AuthenticationResponse.h>
 #include <Messages/ClientMessageFactory.h>
 #include <Messages/NotifyPlayerJoined.h>
+#include <Messages/NotifyMessageBundle.h>
 #include <Messages/NotifyPlayerLeft.h>
 #include <Messages/NotifySettingsChange.h>
 #include <console/ConsoleRegistry.h>
@@ -33,7 +36,7 @@ Console::Setting bPremiumTickrate{"GameServer:bPremiumMode", "Use premium tick r
 
 Console::StringSetting sServerName{"GameServer:sServerName", "Name that shows up in the server list",
                                    "Dedicated Together Server"};
-// Console::StringSetting sAdminPassword{"GameServer:sAdminPassword", "Admin authentication password", ""};
+Console::StringSetting sAdminPassword{"GameServer:sAdminPassword", "Admin authentication password", ""};
 Console::StringSetting sPassword{"GameServer:sPassword", "Server password", ""};
 
 // Gameplay
@@ -64,6 +67,7 @@ Console::Setting bAllowMO2{"ModPolicy:bAllowMO2", "Allow clients running Mod Org
 Console::Command<> TogglePremium("TogglePremium", "Toggle Premium Tickrate on/off", [](Console::ArgStack&) {
     bPremiumTickrate = !bPremiumTickrate;
     spdlog::get("ConOut")->info("Premium Tickrate has been {}.", bPremiumTickrate == true ? "enabled" : "disabled");
+    GameServer::Get()->UpdateTickRate();
 });
 
 Console::Command<> TogglePvp("TogglePvp", "Toggle PvP on/off", [](Console::ArgStack&) {
@@ -128,6 +132,12 @@ static uint16_t GetUserTickRate()
     return bPremiumTickrate ? 60 : 30;
 }
 
+// The transport calls OnUpdate on every network update, the tick scheduler alone paces the ticks
+constexpr uint32_t kUncappedHostTickRate = 1000;
+
+// Steam sockets cannot be waited on, this bounds how long a packet waits while we sleep between ticks
+constexpr auto kNetworkPollInterval = 1ms;
+
 static bool IsMoPoActive()
 {
     return bEnableModCheck;
@@ -153,7 +163,7 @@ GameServer::GameServer(Console::ConsoleRegistry& aConsole) noexcept
     s_pInstance = this;
 
     auto port = uServerPort.value_as<uint16_t>();
-    while (!Host(port, GetUserTickRate()))
+    while (!Host(port, kUncappedHostTickRate))
     {
         spdlog::warn("Port {} is already in use, trying {}", port, port + 1);
         port++;
@@ -182,6 +192,7 @@ GameServer::GameServer(Console::ConsoleRegistry& aConsole) noexcept
     spdlog::info("Server {} started on port {}", BUILD_COMMIT, GetPort());
     UpdateTitle();
 
+    m_scheduler.SetTickRate(GetUserTickRate());
     m_pWorld = MakeUnique<World>();
 
     BindMessageHandlers();
@@ -239,35 +250,9 @@ bool GameServer::CheckMoPo()
 
 void GameServer::BindMessageHandlers()
 {
-    auto handlerGenerator = [this](auto& x) {
-        using T = typename std::remove_reference_t<decltype(x)>::Type;
-
-        m_messageHandlers[T::Opcode] = [this](UniquePtr<ClientMessage>& apMessage, ConnectionId_t aConnectionId) {
-            auto* pPlayer = m_pWorld->GetPlayerManager().GetByConnectionId(aConnectionId);
-
-            if (!pPlayer)
-            {
-                spdlog::error("Connection {:x} is not associated with a player.", aConnectionId);
-                Kick(aConnectionId);
-                return;
-            }
-
-            const auto pRealMessage = CastUnique<T>(std::move(apMessage));
-
-            m_pWorld->GetDispatcher().trigger(PacketEvent<T>(pRealMessage.get(), pPlayer));
-        };
-
-        return false;
-    };
-
-    ClientMessageFactory::Visit(handlerGenerator);
-
-    // Override authentication request
-    m_messageHandlers[AuthenticationRequest::Opcode] = [this](UniquePtr<ClientMessage>& apMessage,
-                                                              ConnectionId_t aConnectionId) {
-        const auto pRealMessage = CastUnique<AuthenticationRequest>(std::move(apMessage));
-        HandleAuthenticationRequest(aConnectionId, pRealMessage);
-    };
+    // Sections are registered up front so dispatching a packet does not hash its name
+    for (uint32_t i = 0; i < kClientOpcodeMax; ++i)
+        m_packetSections[i] = TickProfiler::Get().Register(fmt::format("Packet {}", i));
 
     auto adminHandlerGenerator = [this](auto& x) {
         using T = typename std::remove_reference_t<decltype(x)>::Type;
@@ -340,6 +325,61 @@ void GameServer::BindServerCommands()
 
     m_commands.RegisterCommand<>("quit", "Stop the server", [&](Console::ArgStack&) { Kill(); });
 
+    m_commands.RegisterCommand<>("packetstats", "Show send buffer pool statistics", [&](Console::ArgStack&) {
+        auto out = spdlog::get("ConOut");
+        const auto stats = PacketBufferPool::GetStats();
+
+        out->info("<------Packet buffers--->");
+        out->info("Serialized packets: {}", stats.Serializations);
+        out->info("Buffer allocations: {} ({} regrows, {} KiB)", stats.Allocations, stats.Regrows,
+                  stats.AllocatedBytes / 1024);
+        out->info("Allocations avoided: {} ({} MiB)", stats.GetAllocationsAvoided(),
+                  stats.GetBytesAvoided() / (1024 * 1024));
+    });
+
+    m_commands.RegisterCommand<>("scripts", "Show the time spent in script event handlers", [&](Console::ArgStack&) {
+        auto out = spdlog::get("ConOut");
+        const auto& stats = m_pWorld->GetScriptService().GetScriptStats();
+        if (stats.empty())
+        {
+            out->warn("No scripts loaded");
+            return;
+        }
+
+        out->info("<------Scripts-({})--->", stats.size());
+        for (const auto& pStats : stats)
+        {
+            const auto cCalls = pStats->Calls.load(std::memory_order_relaxed);
+            const auto cTotal = pStats->TotalMicroseconds.load(std::memory_order_relaxed);
+
+            out->info("{}: {} calls, {} us total, {} us avg, {} us max", pStats->Name.c_str(), cCalls, cTotal,
+                      cCalls ? cTotal / cCalls : 0, pStats->MaxMicroseconds.load(std::memory_order_relaxed));
+        }
+    });
+
+    m_commands.RegisterCommand<>("stats", "Show where the server tick spends its time", [&](Console::ArgStack&) {
+        auto out = spdlog::get("ConOut");
+        const auto& profiler = TickProfiler::Get();
+        const auto report = profiler.GetReport();
+        if (report.empty())
+        {
+            out->warn("No complete profiling window yet, try again in {}s",
+                      std::chrono::duration_cast<std::chrono::seconds>(TickProfiler::kWindow).count());
+            return;
+        }
+
+        const auto cWindow = std::chrono::duration_cast<std::chrono::milliseconds>(profiler.GetReportDuration()).count();
+
+        out->info("<------Tick profile-(last {} ms)--->", cWindow);
+        for (const auto& entry : report)
+        {
+            const auto& samples = entry.Samples;
+            out->info("{}: {} calls, {:.2f} ms total, avg {} us, p50 {} us, p99 {} us, max {} us", entry.Name.c_str(),
+                      samples.Count, samples.TotalMicroseconds / 1000.0, samples.TotalMicroseconds / samples.Count,
+                      samples.GetPercentile(0.5), samples.GetPercentile(0.99), samples.MaxMicroseconds);
+        }
+    });
+
     m_commands.RegisterCommand<int64_t, int64_t>(
         "SetTime", "Set ingame hour and minute", [&](Console::ArgStack& aStack) {
             auto out = spdlog::get("ConOut");
@@ -421,20 +461,46 @@ void GameServer::UpdateTimeScale()
 
 void GameServer::OnUpdate()
 {
-    const auto cNow = std::chrono::high_resolution_clock::now();
-    const auto cDelta = cNow - m_lastFrameTime;
-    m_lastFrameTime = cNow;
+    const auto cTickTime = TickScheduler::Clock::now();
+
+    if (m_scheduler.BeginTick(cTickTime))
+    {
+        TICK_PROFILE_SCOPE("Tick");
 
-    const auto cDeltaSeconds = std::chrono::duration_cast<std::chrono::duration<float>>(cDelta).count();
+        const auto cNow = std::chrono::high_resolution_clock::now();
+        const auto cDelta = cNow - m_lastFrameTime;
+        m_lastFrameTime = cNow;
 
-    auto& dispatcher = m_pWorld->GetDispatcher();
+        const auto cDeltaSeconds = std::chrono::duration_cast<std::chrono::duration<float>>(cDelta).count();
 
-    dispatcher.trigger(UpdateEvent{cDeltaSeconds});
+        auto& dispatcher = m_pWorld->GetDispatcher();
+
+        {
+            TICK_PROFILE_SCOPE("UpdateEvent");
+            dispatcher.trigger(UpdateEvent{cDeltaSeconds});
+        }
+
+        m_scheduler.RunJobs(cTickTime);
+
+        FlushBundles();
+    }
+
+    TickProfiler::Get().Update(cTickTime);
 
     if (m_requestStop)
         Close();
 }
 
+void GameServer::WaitForNextTick() const noexcept
+{
+    auto wakeUpTime = m_scheduler.GetNextTick();
+
+    if (GetClientCount() > 0)
+        wakeUpTime = std::min(wakeUpTime, TickScheduler::Clock::now() + kNetworkPollInterval);
+
+    std::this_thread::sleep_until(wakeUpTime);
+}
+
 void GameServer::OnConsume(const void* apData, const uint32_t aSize, const ConnectionId_t aConnectionId)
 {
     ViewBuffer buf((uint8_t*)apData, aSize);
@@ -454,15 +520,39 @@ void GameServer::OnConsume(const void* apData, const uint32_t aSize, const Conne
     }
     else
     {
-        const ClientMessageFactory factory;
-        auto pMessage = factory.Extract(reader);
-        if (!pMessage)
-        {
+        static const uint32_t s_deserializeSection = TickProfiler::Get().Register("Deserialize");
+
+        const auto cStart = TickProfiler::Clock::now();
+        const bool cHandled = m_messageFactory.Dispatch(reader, [this, cStart, aConnectionId](auto& aMessage) {
+            TickProfiler::Get().Record(s_deserializeSection, TickProfiler::Clock::now() - cStart);
+            HandleMessage(aMessage, aConnectionId);
+        });
+
+        if (!cHandled)
             spdlog::error("Couldn't parse packet from {:x}", aConnectionId);
+    }
+}
+
+template <class T> void GameServer::HandleMessage(T& aMessage, const ConnectionId_t aConnectionId)
+{
+    const TickProfiler::Scope scope(m_packetSections[T::Opcode]);
+
+    if constexpr (std::is_same_v<T, AuthenticationRequest>)
+    {
+        HandleAuthenticationRequest(aConnectionId, aMessage);
+    }
+    else
+    {
+        auto* pPlayer = m_pWorld->GetPlayerManager().GetByConnectionId(aConnectionId);
+
+        if (!pPlayer)
+        {
+            spdlog::error("Connection {:x} is not associated with a player.", aConnectionId);
+            Kick(aConnectionId);
             return;
         }
 
-        m_messageHandlers[pMessage->GetOpcode()](pMessage, aConnectionId);
+        m_pWorld->GetDispatcher().trigger(PacketEvent<T>(&aMessage, pPlayer));
     }
 }
 
@@ -475,6 +565,7 @@ void GameServer::OnConnection(const ConnectionId_t aHandle)
 void GameServer::OnDisconnection(const ConnectionId_t aConnectionId, EDisconnectReason aReason)
 {
     m_adminSessions.erase(aConnectionId);
+    m_bundles.erase(aConnectionId);
 
     auto* pPlayer = m_pWorld->GetPlayerManager().GetByConnectionId(aConnectionId);
 
@@ -528,59 +619,47 @@ void GameServer::OnDisconnection(const ConnectionId_t aConnectionId, EDisconnect
 
 void GameServer::Send(const ConnectionId_t aConnectionId, const ServerMessage& acServerMessage) const
 {
-    static thread_local TiltedPhoques::ScratchAllocator s_allocator{1 << 18};
-
-    Buffer buffer(1 << 20);
-    Buffer::Writer writer(&buffer);
-    writer.WriteBits(0, 8); // Skip the first byte as it is used by packet
-
-    acServerMessage.Serialize(writer);
+    SendSerialized(aConnectionId, Serialize(acServerMessage));
+}
 
-    TiltedPhoques::PacketView packet(reinterpret_cast<char*>(buffer.GetWriteData()),
-                                     static_cast<uint32_t>(writer.Size()));
-    Server::Send(aConnectionId, &packet);
+void GameServer::Send(ConnectionId_t aConnectionId, const ServerAdminMessage& acServerMessage) const
+{
+    const auto packet =
+        PacketBufferPool::Get().Write(PacketBufferPool::kAdminKeyOffset + acServerMessage.GetOpcode(),
+                                      [&acServerMessage](Buffer::Writer& aWriter) { acServerMessage.Serialize(aWriter); });
 
-    s_allocator.Reset();
+    SendSerialized(aConnectionId, packet);
 }
 
-void GameServer::Send(ConnectionId_t aConnectionId, const ServerAdminMessage& acServerMessage) const
+PacketBufferPool::Lease GameServer::Serialize(const ServerMessage& acServerMessage) const noexcept
 {
-    static thread_local TiltedPhoques::ScratchAllocator s_allocator{1 << 18};
+    TICK_PROFILE_SCOPE("Serialize");
 
-    Buffer buffer(1 << 20);
-    Buffer::Writer writer(&buffer);
-    writer.WriteBits(0, 8); // Skip the first byte as it is used by packet
+    return PacketBufferPool::Get().Write(acServerMessage.GetOpcode(), [&acServerMessage](Buffer::Writer& aWriter) {
+        acServerMessage.Serialize(aWriter);
+    });
+}
 
-    acServerMessage.Serialize(writer);
+void GameServer::SendSerialized(ConnectionId_t aConnectionId, const PacketBufferPool::Lease& acPacket) const
+{
+    TICK_PROFILE_SCOPE("Send");
 
-    TiltedPhoques::PacketView packet(reinterpret_cast<char*>(buffer.GetWriteData()),
-                                     static_cast<uint32_t>(writer.Size()));
+    TiltedPhoques::PacketView packet(reinterpret_cast<char*>(acPacket.GetData()), acPacket.GetSize());
     Server::Send(aConnectionId, &packet);
-
-    s_allocator.Reset();
 }
 
 void GameServer::SendToLoaded(const ServerMessage& acServerMessage) const
 {
-    for (Player* pPlayer : m_pWorld->GetPlayerManager())
-    {
-        if (pPlayer->GetCellComponent())
-            pPlayer->Send(acServerMessage);
-    }
+    Multicast(acServerMessage, [](const Player* apPlayer) { return static_cast<bool>(apPlayer->GetCellComponent()); });
 }
 
 void GameServer::SendToPlayers(const ServerMessage& acServerMessage, const Player* apExcludedPlayer) const
 {
-    for (Player* pPlayer : m_pWorld->GetPlayerManager())
-    {
-        if (pPlayer != apExcludedPlayer)
-            pPlayer->Send(acServerMessage);
-    }
+    Multicast(acServerMessage, [apExcludedPlayer](const Player* apPlayer) { return apPlayer != apExcludedPlayer; });
 }
 
 // NOTE: this doesn't check objects in range, only characters in range.
-bool GameServer::SendToPlayersInRange(const ServerMessage& acServerMessage, const entt::entity acOrigin,
-                                      const Player* apExcludedPlayer) const
+template <class T> bool GameServer::ForEachPlayerInRange(const entt::entity acOrigin, const Player* apExcludedPlayer, const T& acFunctor) const
 {
     if (!m_pWorld->valid(acOrigin))
     {
@@ -603,13 +682,91 @@ bool GameServer::SendToPlayersInRange(const ServerMessage& acServerMessage, cons
     if (const auto* characterComponent = m_pWorld->try_get<CharacterComponent>(acOrigin))
         isDragon = characterComponent->IsDragon();
 
-    for (Player* pPlayer : m_pWorld->GetPlayerManager())
+    m_pWorld->GetMap().ForEachPlayerInRange(cellComponent, isDragon, [&](const Player* apPlayer) {
+        if (apPlayer != apExcludedPlayer)
+            acFunctor(apPlayer);
+    });
+
+    return true;
+}
+
+bool GameServer::SendToPlayersInRange(const ServerMessage& acServerMessage, const entt::entity acOrigin,
+                                      const Player* apExcludedPlayer) const
+{
+    PacketBufferPool::Lease packet;
+    return ForEachPlayerInRange(acOrigin, apExcludedPlayer, [&](const Player* apPlayer) {
+        if (!packet)
+            packet = Serialize(acServerMessage);
+
+        SendSerialized(apPlayer->GetConnectionId(), packet);
+    });
+}
+
+bool GameServer::QueueToPlayersInRange(const ServerMessage& acServerMessage, const entt::entity acOrigin,
+                                       const Player* apExcludedPlayer) const
+{
+    std::optional<QueuedMessage> queued;
+    return ForEachPlayerInRange(acOrigin, apExcludedPlayer, [&](const Player* apPlayer) {
+        if (!queued)
+        {
+            const auto cPacket = Serialize(acServerMessage);
+
+            // Skip the packet header byte, the message is framed by the bundle
+            const auto* pData = cPacket.GetData() + 1;
+            queued = QueuedMessage{static_cast<uint32_t>(m_bundleData.size()), cPacket.GetSize() - 1};
+            m_bundleData.insert(std::end(m_bundleData), pData, pData + queued->Size);
+        }
+
+        m_bundles[apPlayer->GetConnectionId()].push_back(*queued);
+    });
+}
+
+void GameServer::FlushBundles() noexcept
+{
+    TICK_PROFILE_SCOPE("FlushBundles");
+
+    NotifyMessageBundle bundle;
+
+    for (auto itor = std::begin(m_bundles); itor != std::end(m_bundles); ++itor)
     {
-        if (cellComponent.IsInRange(pPlayer->GetCellComponent(), isDragon) && pPlayer != apExcludedPlayer)
-            pPlayer->Send(acServerMessage);
+        const auto cConnectionId = itor->first;
+        auto& queue = itor.value();
+
+        for (size_t i = 0; i < queue.size();)
+        {
+            bundle.Payloads.clear();
+
+            size_t bundleSize = 0;
+            for (; i < queue.size(); ++i)
+            {
+                const auto& cMessage = queue[i];
+                if (!bundle.Payloads.empty() && bundleSize + cMessage.Size > NotifyMessageBundle::kMaxBundleSize)
+                    break;
+
+                bundle.Payloads.emplace_back(m_bundleData.data() + cMessage.Offset, cMessage.Size);
+                bundleSize += cMessage.Size;
+            }
+
+            // A lone message doesn't need the framing, send it as is
+            if (bundle.Payloads.size() == 1)
+            {
+                const auto cPayload = bundle.Payloads[0];
+                const auto cPacket = PacketBufferPool::Get().Write(NotifyMessageBundle::Opcode, [cPayload](Buffer::Writer& aWriter) {
+                    aWriter.WriteBytes(cPayload.data(), cPayload.size());
+                });
+
+                SendSerialized(cConnectionId, cPacket);
+            }
+            else
+            {
+                Send(cConnectionId, bundle);
+            }
+        }
+
+        queue.clear();
     }
 
-    return true;
+    m_bundleData.clear();
 }
 
 void GameServer::SendToParty(const ServerMessage& acServerMessage, const PartyComponent& acPartyComponent,
@@ -621,17 +778,9 @@ void GameServer::SendToParty(const ServerMessage& acServerMessage, const PartyCo
         return;
     }
 
-    for (Player* pPlayer : m_pWorld->GetPlayerManager())
-    {
-        if (pPlayer == apExcludeSender)
-            continue;
-
-        const auto& partyComponent = pPlayer->GetParty();
-        if (partyComponent.JoinedPartyId == acPartyComponent.JoinedPartyId)
-        {
-            pPlayer->Send(acServerMessage);
-        }
-    }
+    Multicast(acServerMessage, [&](const Player* apPlayer) {
+        return apPlayer != apExcludeSender && apPlayer->GetParty().JoinedPartyId == acPartyComponent.JoinedPartyId;
+    });
 }
 
 void GameServer::SendToPartyInRange(const ServerMessage& acServerMessage, const PartyComponent& acPartyComponent,
@@ -654,19 +803,15 @@ void GameServer::SendToPartyInRange(const ServerMessage& acServerMessage, const
 
     const auto& cellComponent = view.get<CellIdComponent>(*it);
 
-    for (Player* pPlayer : m_pWorld->GetPlayerManager())
-    {
-        if (pPlayer == apExcludeSender)
-            continue;
+    Multicast(acServerMessage, [&](const Player* apPlayer) {
+        if (apPlayer == apExcludeSender)
+            return false;
 
-        if (!cellComponent.IsInRange(pPlayer->GetCellComponent(), false))
-            continue;
+        if (!cellComponent.IsInRange(apPlayer->GetCellComponent(), false))
+            return false;
 
-        if (pPlayer->GetParty().JoinedPartyId != acPartyComponent.JoinedPartyId)
-            continue;
-
-        pPlayer->Send(acServerMessage);
-    }
+        return apPlayer->GetParty().JoinedPartyId == acPartyComponent.JoinedPartyId;
+    });
 }
 
 static String PrettyPrintModList(const Vector<Mods::Entry>& acMods)
@@ -682,13 +827,7 @@ static String PrettyPrintModList(const Vector<Mods::Entry>& acMods)
     return text;
 }
 
-bool GameServer::ValidateAuthParams(ConnectionId_t aConnectionId, const UniquePtr<AuthenticationRequest>& acRequest)
-{
-    return false;
-}
-
-void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
-                                             const UniquePtr<AuthenticationRequest>& acRequest)
+void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId, AuthenticationRequest& aRequest)
 {
     const auto info = GetConnectionInfo(aConnectionId);
 
@@ -707,10 +846,10 @@ void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
     };
 #if 1
     // to make our testing life a bit easier.
-    if (acRequest->Version != BUILD_COMMIT)
+    if (aRequest.Version != BUILD_COMMIT)
     {
         spdlog::info("New player {:x} '{}' tried to connect with client {} - Version mismatch", aConnectionId,
-                     remoteAddress, acRequest->Version.c_str());
+                     remoteAddress, aRequest.Version.c_str());
         sendKick(RT::kWrongVersion);
         return;
     }
@@ -722,8 +861,8 @@ void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
         return;
     }
 
-    bool skseProblem = !bAllowSKSE && acRequest->SKSEActive;
-    bool mo2Problem = !bAllowMO2 && acRequest->MO2Active;
+    bool skseProblem = !bAllowSKSE && aRequest.SKSEActive;
+    bool mo2Problem = !bAllowMO2 && aRequest.MO2Active;
 
     if (skseProblem || mo2Problem)
     {
@@ -736,14 +875,14 @@ void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
         spdlog::info("New player {:x} '{}' tried to connect, but {}{} disallowed - Kicked.", aConnectionId,
                      remoteAddress, response.c_str(), skseProblem && mo2Problem ? "are" : "is");
 
-        serverResponse.SKSEActive = acRequest->SKSEActive;
-        serverResponse.MO2Active = acRequest->MO2Active;
+        serverResponse.SKSEActive = aRequest.SKSEActive;
+        serverResponse.MO2Active = aRequest.MO2Active;
         sendKick(RT::kClientModsDisallowed);
         return;
     }
 
     // check if the proper server password was supplied.
-    if (acRequest->Token == sPassword.value())
+    if (aRequest.Token == sPassword.value())
     {
         Mods& responseList = serverResponse.UserMods;
         auto& modsComponent = m_pWorld->ctx().at<ModsComponent>();
@@ -754,7 +893,7 @@ void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
             // modscomponent contains a list filled in by the recordcollection
             Mods modsToRemove;
 
-            const auto& userMods = acRequest->UserMods.ModList;
+            const auto& userMods = aRequest.UserMods.ModList;
             for (const Mods::Entry& mod : userMods)
             {
                 // if the client has more mods than the server..
@@ -805,7 +944,7 @@ void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
         Vector<uint16_t> playerModsIds;
 
         size_t i = 0;
-        for (auto& mod : acRequest->UserMods.ModList)
+        for (auto& mod : aRequest.UserMods.ModList)
         {
             const uint32_t id =
                 mod.IsLite ? modsComponent.AddLite(mod.Filename) : modsComponent.AddStandard(mod.Filename);
@@ -822,11 +961,11 @@ void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
 
         Player* pPlayer = m_pWorld->GetPlayerManager().Create(aConnectionId);
         pPlayer->SetEndpoint(remoteAddress);
-        pPlayer->SetDiscordId(acRequest->DiscordId);
-        pPlayer->SetUsername(std::move(acRequest->Username));
+        pPlayer->SetDiscordId(aRequest.DiscordId);
+        pPlayer->SetUsername(std::move(aRequest.Username));
         pPlayer->SetMods(playerMods);
         pPlayer->SetModIds(playerModsIds);
-        pPlayer->SetLevel(acRequest->Level);
+        pPlayer->SetLevel(aRequest.Level);
 
         // this event is shit, needs to be fixed, i know
         auto [canceled, reason] = m_pWorld->GetScriptService().HandlePlayerJoin(aConnectionId);
@@ -840,9 +979,9 @@ void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
 
         serverResponse.PlayerId = pPlayer->GetId();
 
-        auto modList = PrettyPrintModList(acRequest->UserMods.ModList);
+        auto modList = PrettyPrintModList(aRequest.UserMods.ModList);
         spdlog::info("New player '{}' [{:x}] connected with {} mods\n\t: {}", pPlayer->GetUsername().c_str(),
-                     aConnectionId, acRequest->UserMods.ModList.size(), modList.c_str());
+                     aConnectionId, aRequest.UserMods.ModList.size(), modList.c_str());
 
         serverResponse.Settings = GetSettings();
 
@@ -876,18 +1015,16 @@ void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
             Send(pPlayer->GetConnectionId(), notify);
         }
 
-        m_pWorld->GetDispatcher().trigger(PlayerJoinEvent(pPlayer, acRequest->WorldSpaceId, acRequest->CellId, acRequest->PlayerTime));
+        m_pWorld->GetDispatcher().trigger(PlayerJoinEvent(pPlayer, aRequest.WorldSpaceId, aRequest.CellId, aRequest.PlayerTime));
     }
-    /*
-        else if (acRequest->Token == sAdminPassword.value() && !sAdminPassword.empty())
-        {
-            AdminSessionOpen response;
-            Send(aConnectionId, response);
+    else if (!sAdminPassword.empty() && aRequest.Token == sAdminPassword.value())
+    {
+        AdminSessionOpen response;
+        Send(aConnectionId, response);
 
-            m_adminSessions.insert(aConnectionId);
-            spdlog::warn("New admin session for {:x} '{}'", aConnectionId, remoteAddress);
-        }
-    */
+        m_adminSessions.insert(aConnectionId);
+        spdlog::warn("New admin session for {:x} '{}'", aConnectionId, remoteAddress);
+    }
     else
     {
         spdlog::info("New player {:x} '{}' has a bad password, kicking.", aConnectionId, remoteAddress);
@@ -895,6 +1032,14 @@ void GameServer::HandleAuthenticationRequest(const ConnectionId_t aConnectionId,
     }
 }
 
+void GameServer::UpdateTickRate()
+{
+    m_scheduler.SetTickRate(GetUserTickRate());
+
+    UpdateInfo();
+    UpdateTitle();
+}
+
 void GameServer::UpdateSettings()
 {
     NotifySettingsChange notify{};
@@ -922,7 +1067,7 @@ void GameServer::UpdateTitle() const
     const char* playerText = GetClientCount() <= 1 ? " player" : " players";
 
     const auto title = fmt::format("{} - {} {} - {} Ticks - " BUILD_BRANCH "@" BUILD_COMMIT, name.c_str(),
-                                   GetClientCount(), playerText, GetTickRate());
+                                   GetClientCount(), playerText, GetUserTickRate());
 
 #if TP_PLATFORM_WINDOWS
     SetConsoleTitleA(title.c_str());
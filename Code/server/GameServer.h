@@ -2,8 +2,12 @@
 
 #include <AdminMessages/Message.h>
 #include <Messages/AuthenticationRequest.h>
+#include <Messages/ClientMessageFactory.h>
 #include <Messages/Message.h>
 #include <World.h>
+#include <Game/PacketBufferPool.h>
+#include <Game/Player.h>
+#include <Game/TickScheduler.h>
 
 using TiltedPhoques::ConnectionId_t;
 using TiltedPhoques::Server;
@@ -52,6 +56,12 @@ struct GameServer final : Server
     void UpdateInfo();
     void UpdateTimeScale();
     void UpdateSettings();
+    void UpdateTickRate();
+
+    /**
+     * @brief Sleeps until the next tick is due, waking up early to poll the network while players are connected.
+     */
+    void WaitForNextTick() const noexcept;
 
     // Packet dispatching
     void Send(ConnectionId_t aConnectionId, const ServerMessage& acServerMessage) const;
@@ -65,6 +75,43 @@ struct GameServer final : Server
     void SendToPartyInRange(const ServerMessage& acServerMessage, const PartyComponent& acPartyComponent,
                             const entt::entity acOrigin, const Player* apExcludeSender = nullptr) const;
 
+    /**
+     * @brief Queues a message for the players in range, each player gets its queued messages as one bundle at the end of the tick.
+     *
+     * Meant for frequent notifications such as combat, queued messages keep their order between themselves
+     * but are received after anything sent directly during the tick.
+     */
+    bool QueueToPlayersInRange(const ServerMessage& acServerMessage, const entt::entity acOrigin,
+                               const Player* apExcludeSender = nullptr) const;
+
+    /**
+     * @brief Serializes a message once and sends the same bytes to every player accepted by the predicate.
+     *
+     * Nothing is serialized if no player is accepted.
+     *
+     * @param acPredicate bool(const Player*)
+     * @return The number of players the message was sent to.
+     */
+    template <class T> uint32_t Multicast(const ServerMessage& acServerMessage, const T& acPredicate) const
+    {
+        PacketBufferPool::Lease packet;
+        uint32_t recipientCount = 0;
+
+        for (const Player* pPlayer : m_pWorld->GetPlayerManager())
+        {
+            if (!acPredicate(pPlayer))
+                continue;
+
+            if (!packet)
+                packet = Serialize(acServerMessage);
+
+            SendSerialized(pPlayer->GetConnectionId(), packet);
+            ++recipientCount;
+        }
+
+        return recipientCount;
+    }
+
     const Info& GetInfo() const noexcept
     {
         return m_info;
@@ -99,9 +146,13 @@ struct GameServer final : Server
         return *m_pWorld;
     }
 
+    TickScheduler& GetScheduler() noexcept
+    {
+        return m_scheduler;
+    }
+
   protected:
-    bool ValidateAuthParams(ConnectionId_t aConnectionId, const UniquePtr<AuthenticationRequest>& acRequest);
-    void HandleAuthenticationRequest(ConnectionId_t aConnectionId, const UniquePtr<AuthenticationRequest>& acRequest);
+    void HandleAuthenticationRequest(ConnectionId_t aConnectionId, AuthenticationRequest& aRequest);
 
     // Implement TiltedPhoques::Server
     void OnUpdate() override;
@@ -112,11 +163,26 @@ struct GameServer final : Server
   private:
     void UpdateTitle() const;
 
+    template <class T> void HandleMessage(T& aMessage, ConnectionId_t aConnectionId);
+
+    [[nodiscard]] PacketBufferPool::Lease Serialize(const ServerMessage& acServerMessage) const noexcept;
+    void SendSerialized(ConnectionId_t aConnectionId, const PacketBufferPool::Lease& acPacket) const;
+
+    /**
+     * @brief Calls the functor for every player in range of the origin but the excluded one.
+     *
+     * @param acFunctor void(const Player*)
+     * @return false if the origin has no cell.
+     */
+    template <class T> bool ForEachPlayerInRange(const entt::entity acOrigin, const Player* apExcludedPlayer, const T& acFunctor) const;
+    void FlushBundles() noexcept;
+
   private:
     std::chrono::high_resolution_clock::time_point m_startTime;
     std::chrono::high_resolution_clock::time_point m_lastFrameTime;
-    std::function<void(UniquePtr<ClientMessage>&, ConnectionId_t)> m_messageHandlers[kClientOpcodeMax];
+    ClientMessageFactory m_messageFactory;
     std::function<void(UniquePtr<ClientAdminMessage>&, ConnectionId_t)> m_adminMessageHandlers[kClientAdminOpcodeMax];
+    uint32_t m_packetSections[kClientOpcodeMax]{};
 
     bool m_isPasswordProtected{};
 
@@ -127,6 +193,19 @@ struct GameServer final : Server
     TiltedPhoques::Set<ConnectionId_t> m_adminSessions;
     TiltedPhoques::Map<ConnectionId_t, entt::entity> m_connectionToEntity;
 
+    // A message queued by QueueToPlayersInRange, located in m_bundleData
+    struct QueuedMessage
+    {
+        uint32_t Offset;
+        uint32_t Size;
+    };
+
+    // Serialized once per message and shared by every recipient, cleared when bundles are flushed
+    mutable Vector<uint8_t> m_bundleData;
+    mutable TiltedPhoques::Map<ConnectionId_t, Vector<QueuedMessage>> m_bundles;
+
+    // Declared before the world as services register their jobs into it
+    TickScheduler m_scheduler;
     UniquePtr<World> m_pWorld;
 
     bool m_requestStop;
@@ -28,6 +28,7 @@
 #include <filesystem>
 #include <codecvt>
 #include <optional>
+#include <thread>
 
 #include <Server.hpp>
 #include <cxxopts.hpp>
@@ -5,20 +5,50 @@ namespace Script
 {
 namespace
 {
+// A component kept from a game thread event could still reach the worker, every field access checks again
+template <class T> auto GameThreadProperty(const char* acpName, T MovementComponent::*apMember)
+{
+    return sol::property(
+        [acpName, apMember](const MovementComponent& acSelf) -> T {
+            if (ScriptWorker::IsWorkerThread())
+            {
+                spdlog::warn("MovementComponent.{} is not available from async script events", acpName);
+                return {};
+            }
+
+            return acSelf.*apMember;
+        },
+        [acpName, apMember](MovementComponent& aSelf, const T& acValue) {
+            if (ScriptWorker::IsWorkerThread())
+            {
+                spdlog::warn("MovementComponent.{} is not available from async script events", acpName);
+                return;
+            }
+
+            aSelf.*apMember = acValue;
+        });
+}
+
 void BindMovementComponent(sol::state_view aState)
 {
-    aState["GetMovementComponent"] = [](entt::entity aEntity) {
+    aState["GetMovementComponent"] = [](entt::entity aEntity) -> MovementComponent* {
+        if (ScriptWorker::IsWorkerThread())
+        {
+            spdlog::warn("GetMovementComponent() is not available from async script events");
+            return nullptr;
+        }
+
         return GameServer::Get()->GetWorld().try_get<MovementComponent>(aEntity);
     };
         
     auto table =
         aState.new_usertype<MovementComponent>("MovementComponent", sol::constructors<MovementComponent()>());
-    table["Tick"] = &MovementComponent::Tick;
-    table["Position"] = &MovementComponent::Position;
-    table["Rotation"] = &MovementComponent::Rotation;
+    table["Tick"] = GameThreadProperty("Tick", &MovementComponent::Tick);
+    table["Position"] = GameThreadProperty("Position", &MovementComponent::Position);
+    table["Rotation"] = GameThreadProperty("Rotation", &MovementComponent::Rotation);
     // movementComponentType["Variables"] = &MovementComponent::Variables;
-    table["Direction"] = &MovementComponent::Direction;
-    table["Sent"] = &MovementComponent::Sent;
+    table["Direction"] = GameThreadProperty("Direction", &MovementComponent::Direction);
+    table["Sent"] = GameThreadProperty("Sent", &MovementComponent::Sent);
 }
 } // namespace
 
@@ -1,26 +1,48 @@
 
 #include "GameServer.h"
 #include <Messages/NotifyChatMessageBroadcast.h>
-#include <regex>
+#include <ChatSanitizer.h>
 
 namespace Script
 {
+namespace
+{
+// Calls from async handlers are deferred to the game thread
+void RunOnGameThread(ScriptWorker::Job aCall)
+{
+    GameServer::Get()->GetWorld().GetScriptService().RunOnGameThread(std::move(aCall));
+}
+} // namespace
+
 void CreateGameServerBindings(sol::state_view aState)
 {
     auto type = aState.new_usertype<GameServer>("GameServer", sol::meta_function::construct, sol::no_constructor);
     type["get"] = []() { return GameServer::Get(); };
-    type["Kill"] = &GameServer::Kill;
-    type["Kick"] = &GameServer::Kick;
-    type["GetTick"] = &GameServer::GetTick;
+    type["Kill"] = [](GameServer& aSelf) { RunOnGameThread([&aSelf] { aSelf.Kill(); }); };
+    type["Kick"] = [](GameServer& aSelf, ConnectionId_t aConnectionId) {
+        RunOnGameThread([&aSelf, aConnectionId] { aSelf.Kick(aConnectionId); });
+    };
+    type["GetTick"] = [](GameServer& aSelf) -> uint64_t {
+        // The tick is advanced by the game thread without synchronization
+        if (ScriptWorker::IsWorkerThread())
+        {
+            spdlog::warn("GameServer:GetTick() is not available from async script events");
+            return 0;
+        }
+
+        return aSelf.GetTick();
+    };
 
     type["SendChatMessage"] = [](GameServer& aSelf, ConnectionId_t aConnectionId, const std::string& acMessage) {
         NotifyChatMessageBroadcast notifyMessage{};
 
-        std::regex escapeHtml{"<[^>]+>\\s+(?=<)|<[^>]+>"};
         notifyMessage.MessageType = ChatMessageType::kLocalChat;
         notifyMessage.PlayerName = "[Server]";
-        notifyMessage.ChatMessage = std::regex_replace(acMessage, escapeHtml, "");
-        GameServer::Get()->Send(aConnectionId, notifyMessage);
+        SanitizeChatText(acMessage, notifyMessage.ChatMessage);
+
+        RunOnGameThread([aConnectionId, notifyMessage = std::move(notifyMessage)] {
+            GameServer::Get()->Send(aConnectionId, notifyMessage);
+        });
     };
     // type["SendPacket"]
 }
@@ -6,51 +6,138 @@ namespace Script
 {
 namespace
 {
+// Players belong to the game thread, async script events may not touch them
+template <class... TArgs> auto GameThreadOnly(const char* acpName, void (Player::*apMethod)(TArgs...) noexcept)
+{
+    return [acpName, apMethod](Player& aSelf, TArgs... aArgs) {
+        if (ScriptWorker::IsWorkerThread())
+        {
+            spdlog::warn("Player:{}() is not available from async script events", acpName);
+            return;
+        }
+
+        (aSelf.*apMethod)(std::forward<TArgs>(aArgs)...);
+    };
+}
+
+template <class... TArgs> auto GameThreadOnly(const char* acpName, void (Player::*apMethod)(TArgs...) const)
+{
+    return [acpName, apMethod](const Player& acSelf, TArgs... aArgs) {
+        if (ScriptWorker::IsWorkerThread())
+        {
+            spdlog::warn("Player:{}() is not available from async script events", acpName);
+            return;
+        }
+
+        (acSelf.*apMethod)(std::forward<TArgs>(aArgs)...);
+    };
+}
+
+// Getters hand out copies, a worker gets the default value since the player may be changed or freed concurrently
+template <class TResult> auto GameThreadOnly(const char* acpName, TResult (Player::*apMethod)() const noexcept)
+{
+    return [acpName, apMethod](const Player& acSelf) -> std::decay_t<TResult> {
+        if (ScriptWorker::IsWorkerThread())
+        {
+            spdlog::warn("Player:{}() is not available from async script events", acpName);
+            return {};
+        }
+
+        return (acSelf.*apMethod)();
+    };
+}
+
 void BindPlayer(sol::state_view aState)
 {
     auto playerType = aState.new_usertype<Player>("Player", sol::constructors<Player(ConnectionId_t)>());
 
-    playerType["GetId"] = &Player::GetId;
-    playerType["GetConnectionId"] = &Player::GetConnectionId;
-    playerType["GetCharacter"] = &Player::GetCharacter;
-    playerType["GetParty"] = &Player::GetParty;
-    playerType["GetUsername"] = &Player::GetUsername;
-    playerType["GetEndPoint"] = &Player::GetEndPoint;
-    playerType["GetDiscordId"] = &Player::GetDiscordId;
-    playerType["GetStringCacheId"] = &Player::GetStringCacheId;
-    playerType["GetLevel"] = &Player::GetLevel;
+    playerType["GetId"] = GameThreadOnly("GetId", &Player::GetId);
+    playerType["GetConnectionId"] = GameThreadOnly("GetConnectionId", &Player::GetConnectionId);
+    playerType["GetCharacter"] = GameThreadOnly("GetCharacter", &Player::GetCharacter);
+    playerType["GetParty"] = [](Player& aSelf) -> PartyComponent* {
+        if (ScriptWorker::IsWorkerThread())
+        {
+            spdlog::warn("Player:GetParty() is not available from async script events");
+            return nullptr;
+        }
+
+        return &aSelf.GetParty();
+    };
+    playerType["GetUsername"] = GameThreadOnly("GetUsername", &Player::GetUsername);
+    playerType["GetEndPoint"] = GameThreadOnly("GetEndPoint", &Player::GetEndPoint);
+    playerType["GetDiscordId"] = GameThreadOnly("GetDiscordId", &Player::GetDiscordId);
+    playerType["GetStringCacheId"] = GameThreadOnly("GetStringCacheId", &Player::GetStringCacheId);
+    playerType["GetLevel"] = GameThreadOnly("GetLevel", &Player::GetLevel);
     // playerType["GetCellComponent"] = sol::overload(&Player::GetCellComponent, &Player::GetCellComponent);
     //  playerType["GetQuestLogComponent"] = sol::overload(&Player::GetQuestLogComponent,
     //  &Player::GetQuestLogComponent);
-    playerType["SetDiscordId"] = &Player::SetDiscordId;
-    playerType["SetEndpoint"] = &Player::SetEndpoint;
-    playerType["SetUsername"] = &Player::SetUsername;
-    playerType["SetMods"] = &Player::SetMods;
-    playerType["SetModIds"] = &Player::SetModIds;
-    playerType["SetCharacter"] = &Player::SetCharacter;
-    playerType["SetStringCacheId"] = &Player::SetStringCacheId;
-    playerType["SetLevel"] = &Player::SetLevel;
-    playerType["SetCellComponent"] = &Player::SetCellComponent;
-    playerType["Send"] = &Player::Send;
+    playerType["SetDiscordId"] = GameThreadOnly("SetDiscordId", &Player::SetDiscordId);
+    playerType["SetEndpoint"] = GameThreadOnly("SetEndpoint", &Player::SetEndpoint);
+    playerType["SetUsername"] = GameThreadOnly("SetUsername", &Player::SetUsername);
+    playerType["SetMods"] = GameThreadOnly("SetMods", &Player::SetMods);
+    playerType["SetModIds"] = GameThreadOnly("SetModIds", &Player::SetModIds);
+    playerType["SetCharacter"] = GameThreadOnly("SetCharacter", &Player::SetCharacter);
+    playerType["SetStringCacheId"] = GameThreadOnly("SetStringCacheId", &Player::SetStringCacheId);
+    playerType["SetLevel"] = GameThreadOnly("SetLevel", &Player::SetLevel);
+    playerType["SetCellComponent"] = GameThreadOnly("SetCellComponent", &Player::SetCellComponent);
+    playerType["Send"] = GameThreadOnly("Send", &Player::Send);
 }
 
 void BindPlayerManager(sol::state_view aState)
 {
     auto table =
         aState.new_usertype<PlayerManager>("PlayerManager", sol::meta_function::construct, sol::no_constructor);
-    table["get"] = []() -> PlayerManager& { return GameServer::Get()->GetWorld().GetPlayerManager(); };
+    table["get"] = []() -> PlayerManager* {
+        // Players are only snapshotted into async events, they cannot be looked up from the worker
+        if (ScriptWorker::IsWorkerThread())
+        {
+            spdlog::warn("PlayerManager.get() is not available from async script events");
+            return nullptr;
+        }
+
+        return &GameServer::Get()->GetWorld().GetPlayerManager();
+    };
 
+    // A manager kept from a game thread event could still reach the worker, every lookup checks again
     table["GetByConnectionId"] = [](PlayerManager& aSelf, uint32_t aConnID) -> Player const* {
+        if (ScriptWorker::IsWorkerThread())
+        {
+            spdlog::warn("PlayerManager:GetByConnectionId() is not available from async script events");
+            return nullptr;
+        }
+
         return aSelf.GetByConnectionId(aConnID);
     };
-    table["GetById"] = [](PlayerManager& aSelf, uint32_t aConnID) -> Player const* { return aSelf.GetById(aConnID); };
+    table["GetById"] = [](PlayerManager& aSelf, uint32_t aConnID) -> Player const* {
+        if (ScriptWorker::IsWorkerThread())
+        {
+            spdlog::warn("PlayerManager:GetById() is not available from async script events");
+            return nullptr;
+        }
+
+        return aSelf.GetById(aConnID);
+    };
     table["GetAllPlayers"] = [](PlayerManager& aSelf) {
         std::vector<Player*> allPlayers;
+        if (ScriptWorker::IsWorkerThread())
+        {
+            spdlog::warn("PlayerManager:GetAllPlayers() is not available from async script events");
+            return allPlayers;
+        }
+
         aSelf.ForEach([&](Player* aPlayer) { allPlayers.push_back(aPlayer); });
         return allPlayers;
     };
 
-    table["Count"] = &PlayerManager::Count;
+    table["Count"] = [](const PlayerManager& acSelf) -> uint32_t {
+        if (ScriptWorker::IsWorkerThread())
+        {
+            spdlog::warn("PlayerManager:Count() is not available from async script events");
+            return 0;
+        }
+
+        return acSelf.Count();
+    };
 }
 
 } // namespace
@@ -0,0 +1,96 @@
+#include "ScriptWorker.h"
+
+namespace
+{
+thread_local bool s_isWorkerThread = false;
+}
+
+ScriptWorker::~ScriptWorker() noexcept
+{
+    Stop();
+}
+
+void ScriptWorker::Start() noexcept
+{
+    if (IsRunning())
+        return;
+
+    m_stop.store(false, std::memory_order_release);
+    m_thread = std::thread([this] { Run(); });
+}
+
+void ScriptWorker::Stop() noexcept
+{
+    if (!IsRunning())
+        return;
+
+    m_stop.store(true, std::memory_order_release);
+    m_signal.fetch_add(1, std::memory_order_release);
+    m_signal.notify_one();
+
+    m_thread.join();
+}
+
+bool ScriptWorker::Post(Job aJob) noexcept
+{
+    if (!m_jobs.Push(std::move(aJob)))
+        return false;
+
+    m_signal.fetch_add(1, std::memory_order_release);
+    m_signal.notify_one();
+
+    return true;
+}
+
+bool ScriptWorker::PostToGame(Job aJob) noexcept
+{
+    return m_gameCalls.Push(std::move(aJob));
+}
+
+void ScriptWorker::Pump() noexcept
+{
+    Job call;
+    while (m_gameCalls.Pop(call))
+    {
+        call();
+        call = nullptr;
+    }
+}
+
+bool ScriptWorker::IsWorkerThread() noexcept
+{
+    return s_isWorkerThread;
+}
+
+void ScriptWorker::Run() noexcept
+{
+    s_isWorkerThread = true;
+
+    Job job;
+    while (true)
+    {
+        // Read before draining, a job posted after the drain changes the signal and the wait returns at once
+        const auto cSignal = m_signal.load(std::memory_order_acquire);
+
+        while (m_jobs.Pop(job))
+        {
+            try
+            {
+                job();
+            }
+            catch (std::exception& exception)
+            {
+                spdlog::error("Script worker job failed: {}", exception.what());
+            }
+
+            job = nullptr;
+        }
+
+        if (m_stop.load(std::memory_order_acquire))
+            break;
+
+        m_signal.wait(cSignal, std::memory_order_acquire);
+    }
+
+    s_isWorkerThread = false;
+}
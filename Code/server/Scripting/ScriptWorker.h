@@ -0,0 +1,90 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+/**
+ * @brief Runs script jobs on a dedicated thread.
+ *
+ * Jobs are handed over through single producer, single consumer rings: the game thread posts events to the
+ * worker, the worker posts calls that need the world back to the game thread which runs them in Pump().
+ * Jobs carry copies of the data they need, they never read the world while running on the worker.
+ */
+struct ScriptWorker
+{
+    using Job = std::function<void()>;
+
+    static constexpr size_t kCapacity = 1024;
+
+    ScriptWorker() noexcept = default;
+    ~ScriptWorker() noexcept;
+
+    TP_NOCOPYMOVE(ScriptWorker);
+
+    void Start() noexcept;
+    /**
+     * @brief Runs the jobs that are still queued then joins the thread, calls not pumped yet are dropped.
+     */
+    void Stop() noexcept;
+    [[nodiscard]] bool IsRunning() const noexcept { return m_thread.joinable(); }
+
+    /**
+     * @brief Queues a job for the worker, game thread only.
+     * @return false if the worker is too far behind, the job is dropped.
+     */
+    bool Post(Job aJob) noexcept;
+    /**
+     * @brief Queues a call for the game thread, worker thread only.
+     * @return false if the game thread is too far behind, the call is dropped.
+     */
+    bool PostToGame(Job aJob) noexcept;
+    /**
+     * @brief Runs the calls posted by the worker, game thread only.
+     */
+    void Pump() noexcept;
+
+    [[nodiscard]] static bool IsWorkerThread() noexcept;
+
+private:
+    template <class T, size_t N> struct Ring
+    {
+        static_assert((N & (N - 1)) == 0, "Ring capacity must be a power of two");
+
+        bool Push(T&& aValue) noexcept
+        {
+            const auto cTail = m_tail.load(std::memory_order_relaxed);
+            if (cTail - m_head.load(std::memory_order_acquire) == N)
+                return false;
+
+            m_slots[cTail & (N - 1)] = std::move(aValue);
+            m_tail.store(cTail + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool Pop(T& aValue) noexcept
+        {
+            const auto cHead = m_head.load(std::memory_order_relaxed);
+            if (cHead == m_tail.load(std::memory_order_acquire))
+                return false;
+
+            aValue = std::move(m_slots[cHead & (N - 1)]);
+            m_slots[cHead & (N - 1)] = nullptr;
+            m_head.store(cHead + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        std::array<T, N> m_slots{};
+        alignas(64) std::atomic<size_t> m_head{0};
+        alignas(64) std::atomic<size_t> m_tail{0};
+    };
+
+    void Run() noexcept;
+
+    Ring<Job, kCapacity> m_jobs;
+    Ring<Job, kCapacity> m_gameCalls;
+    std::atomic<uint32_t> m_signal{0};
+    std::atomic<bool> m_stop{false};
+    std::thread m_thread;
+};
@@ -1,4 +1,5 @@
 #include <Components.h>
+#include <Events/UpdateEvent.h>
 #include <Messages/RequestActorValueChanges.h>
 #include <Messages/RequestActorMaxValueChanges.h>
 #include <Messages/RequestHealthChangeBroadcast.h>
@@ -6,24 +7,36 @@
 #include <Services/ActorValueService.h>
 #include <World.h>
 #include <GameServer.h>
+#include <Game/TickProfiler.h>
 #include <Messages/NotifyActorValueChanges.h>
 #include <Messages/NotifyActorMaxValueChanges.h>
 #include <Messages/NotifyHealthChangeBroadcast.h>
 #include <Messages/NotifyDeathStateChange.h>
 
+namespace
+{
+// Same id in Skyrim and Fallout 4
+constexpr uint32_t kHealthId = 24;
+} // namespace
+
 ActorValueService::ActorValueService(World& aWorld, entt::dispatcher& aDispatcher) noexcept
     : m_world(aWorld)
 {
+    m_updateConnection = aDispatcher.sink<UpdateEvent>().connect<&ActorValueService::OnUpdate>(this);
     m_updateHealthConnection = aDispatcher.sink<PacketEvent<RequestActorValueChanges>>().connect<&ActorValueService::OnActorValueChanges>(this);
     m_updateMaxValueConnection = aDispatcher.sink<PacketEvent<RequestActorMaxValueChanges>>().connect<&ActorValueService::OnActorMaxValueChanges>(this);
     m_updateDeltaHealthConnection = aDispatcher.sink<PacketEvent<RequestHealthChangeBroadcast>>().connect<&ActorValueService::OnHealthChangeBroadcast>(this);
     m_deathStateConnection = aDispatcher.sink<PacketEvent<RequestDeathStateChange>>().connect<&ActorValueService::OnDeathStateChange>(this);
 }
 
-void ActorValueService::OnActorValueChanges(const PacketEvent<RequestActorValueChanges>& acMessage) const noexcept
+void ActorValueService::OnActorValueChanges(const PacketEvent<RequestActorValueChanges>& acMessage) noexcept
 {
     auto& message = acMessage.Packet;
 
+    // Also the result of a malformed block, which is read as empty
+    if (message.Values.Empty())
+        return;
+
     auto actorValuesView = m_world.view<ActorValuesComponent, OwnerComponent>();
 
     auto it = actorValuesView.find(static_cast<entt::entity>(message.Id));
@@ -31,25 +44,19 @@ void ActorValueService::OnActorValueChanges(const PacketEvent<RequestActorValueC
     if (it != actorValuesView.end())
     {
         auto& actorValuesComponent = actorValuesView.get<ActorValuesComponent>(*it);
-        for (auto& [id, value] : message.Values)
-        {
-            actorValuesComponent.CurrentActorValues.ActorValuesList[id] = value;
-        }
+        MarkChanged(*it, actorValuesComponent);
+        actorValuesComponent.CurrentActorValues.ActorValuesList.Merge(message.Values);
     }
-
-    NotifyActorValueChanges notify;
-    notify.Id = acMessage.Packet.Id;
-    notify.Values = acMessage.Packet.Values;
-
-    const entt::entity cEntity = static_cast<entt::entity>(message.Id);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, cEntity, acMessage.pPlayer))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
 }
 
-void ActorValueService::OnActorMaxValueChanges(const PacketEvent<RequestActorMaxValueChanges>& acMessage) const noexcept
+void ActorValueService::OnActorMaxValueChanges(const PacketEvent<RequestActorMaxValueChanges>& acMessage) noexcept
 {
     auto& message = acMessage.Packet;
 
+    // Also the result of a malformed block, which is read as empty
+    if (message.Values.Empty())
+        return;
+
     auto actorValuesView = m_world.view<ActorValuesComponent, OwnerComponent>();
 
     auto it = actorValuesView.find(static_cast<entt::entity>(message.Id));
@@ -57,19 +64,9 @@ void ActorValueService::OnActorMaxValueChanges(const PacketEvent<RequestActorMax
     if (it != actorValuesView.end())
     {
         auto& actorValuesComponent = actorValuesView.get<ActorValuesComponent>(*it);
-        for (auto& [id, value] : message.Values)
-        {
-            actorValuesComponent.CurrentActorValues.ActorMaxValuesList[id] = value;
-        }
+        MarkChanged(*it, actorValuesComponent);
+        actorValuesComponent.CurrentActorValues.ActorMaxValuesList.Merge(message.Values);
     }
-
-    NotifyActorMaxValueChanges notify;
-    notify.Id = message.Id;
-    notify.Values = message.Values;
-
-    const entt::entity cEntity = static_cast<entt::entity>(message.Id);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, cEntity, acMessage.pPlayer))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
 }
 
 void ActorValueService::OnHealthChangeBroadcast(const PacketEvent<RequestHealthChangeBroadcast>& acMessage) const noexcept
@@ -84,8 +81,9 @@ void ActorValueService::OnHealthChangeBroadcast(const PacketEvent<RequestHealthC
     if (it != actorValuesView.end())
     {
         auto& actorValuesComponent = actorValuesView.get<ActorValuesComponent>(*it);
-        auto currentHealth = actorValuesComponent.CurrentActorValues.ActorValuesList[24];
-        actorValuesComponent.CurrentActorValues.ActorValuesList[24] = currentHealth - message.DeltaHealth;
+        auto& actorValues = actorValuesComponent.CurrentActorValues.ActorValuesList;
+        actorValues.Set(kHealthId, actorValues.Get(kHealthId) - message.DeltaHealth);
+        actorValuesComponent.IsDirtySpawnCache = true;
     }
 
     NotifyHealthChangeBroadcast notify;
@@ -93,8 +91,8 @@ void ActorValueService::OnHealthChangeBroadcast(const PacketEvent<RequestHealthC
     notify.DeltaHealth = message.DeltaHealth;
 
     const entt::entity cEntity = static_cast<entt::entity>(message.Id);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, cEntity, acMessage.pPlayer))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+    if (!GameServer::Get()->QueueToPlayersInRange(notify, cEntity, acMessage.pPlayer))
+        spdlog::error("{}: QueueToPlayersInRange failed", __FUNCTION__);
 }
 
 void ActorValueService::OnDeathStateChange(const PacketEvent<RequestDeathStateChange>& acMessage) const noexcept
@@ -117,6 +115,56 @@ void ActorValueService::OnDeathStateChange(const PacketEvent<RequestDeathStateCh
     notify.IsDead = message.IsDead;
 
     const entt::entity cEntity = static_cast<entt::entity>(message.Id);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, cEntity, acMessage.pPlayer))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+    if (!GameServer::Get()->QueueToPlayersInRange(notify, cEntity, acMessage.pPlayer))
+        spdlog::error("{}: QueueToPlayersInRange failed", __FUNCTION__);
+}
+
+void ActorValueService::OnUpdate(const UpdateEvent&) noexcept
+{
+    TICK_PROFILE_SCOPE("ActorValueService::OnUpdate");
+
+    for (const auto cEntity : m_changedEntities)
+    {
+        if (!m_world.valid(cEntity))
+            continue;
+
+        auto* pActorValuesComponent = m_world.try_get<ActorValuesComponent>(cEntity);
+        const auto* pOwnerComponent = m_world.try_get<OwnerComponent>(cEntity);
+        if (!pActorValuesComponent || !pOwnerComponent)
+            continue;
+
+        auto& actorValues = pActorValuesComponent->CurrentActorValues;
+        const Player* pOwner = pOwnerComponent->GetOwner();
+
+        if (actorValues.ActorValuesList.IsDirty())
+        {
+            NotifyActorValueChanges notify;
+            notify.Id = World::ToInteger(cEntity);
+            notify.Values = actorValues.ActorValuesList.TakeDirty();
+
+            if (!GameServer::Get()->QueueToPlayersInRange(notify, cEntity, pOwner))
+                spdlog::error("{}: QueueToPlayersInRange failed", __FUNCTION__);
+        }
+
+        if (actorValues.ActorMaxValuesList.IsDirty())
+        {
+            NotifyActorMaxValueChanges notify;
+            notify.Id = World::ToInteger(cEntity);
+            notify.Values = actorValues.ActorMaxValuesList.TakeDirty();
+
+            if (!GameServer::Get()->QueueToPlayersInRange(notify, cEntity, pOwner))
+                spdlog::error("{}: QueueToPlayersInRange failed", __FUNCTION__);
+        }
+    }
+
+    m_changedEntities.clear();
+}
+
+void ActorValueService::MarkChanged(entt::entity aEntity, ActorValuesComponent& aComponent) noexcept
+{
+    auto& actorValues = aComponent.CurrentActorValues;
+    if (!actorValues.ActorValuesList.IsDirty() && !actorValues.ActorMaxValuesList.IsDirty())
+        m_changedEntities.push_back(aEntity);
+
+    aComponent.IsDirtySpawnCache = true;
 }
@@ -9,9 +9,13 @@ struct RequestActorValueChanges;
 struct RequestActorMaxValueChanges;
 struct RequestHealthChangeBroadcast;
 struct RequestDeathStateChange;
+struct ActorValuesComponent;
 
 /**
  * @brief Broadcasts changes in (max) actor values and updates them server side.
+ *
+ * Value changes are merged into the actor's ActorValuesComponent as they arrive, each actor's changes
+ * are then sent once per tick so an actor reporting several times in a tick costs a single broadcast.
  */
 struct ActorValueService
 {
@@ -23,11 +27,19 @@ struct ActorValueService
 private:
     World& m_world;
 
-    void OnActorValueChanges(const PacketEvent<RequestActorValueChanges>& acMessage) const noexcept;
-    void OnActorMaxValueChanges(const PacketEvent<RequestActorMaxValueChanges>& acMessage) const noexcept;
+    void OnUpdate(const UpdateEvent&) noexcept;
+    void OnActorValueChanges(const PacketEvent<RequestActorValueChanges>& acMessage) noexcept;
+    void OnActorMaxValueChanges(const PacketEvent<RequestActorMaxValueChanges>& acMessage) noexcept;
     void OnHealthChangeBroadcast(const PacketEvent<RequestHealthChangeBroadcast>& acMessage) const noexcept;
     void OnDeathStateChange(const PacketEvent<RequestDeathStateChange>& acMessage) const noexcept;
 
+    // Queues aEntity for this tick's broadcast unless it already has pending changes
+    void MarkChanged(entt::entity aEntity, ActorValuesComponent& aComponent) noexcept;
+
+    Vector<entt::entity> m_changedEntities;
+
+    entt::scoped_connection m_updateConnection;
+
     entt::scoped_connection m_updateHealthConnection;
     entt::scoped_connection m_updateMaxValueConnection;
     entt::scoped_connection m_updateDeltaHealthConnection;
@@ -4,12 +4,16 @@
 #include <Services/AdminService.h>
 
 #include <AdminMessages/AdminShutdownRequest.h>
+#include <AdminMessages/AdminStatsRequest.h>
 #include <AdminMessages/ServerLogs.h>
+#include <AdminMessages/ServerTickStats.h>
+#include <Game/TickProfiler.h>
 
 AdminService::AdminService(World& aWorld, entt::dispatcher& aDispatcher)
     : m_world(aWorld)
 {
     m_shutdownConnection = aDispatcher.sink<AdminPacketEvent<AdminShutdownRequest>>().connect<&AdminService::HandleShutdown>(this);
+    m_statsConnection = aDispatcher.sink<AdminPacketEvent<AdminStatsRequest>>().connect<&AdminService::HandleStatsRequest>(this);
 }
 
 void AdminService::HandleShutdown(const AdminPacketEvent<AdminShutdownRequest>& acMessage) noexcept
@@ -19,6 +23,27 @@ void AdminService::HandleShutdown(const AdminPacketEvent<AdminShutdownRequest>&
     GameServer::Get()->Kill();
 }
 
+void AdminService::HandleStatsRequest(const AdminPacketEvent<AdminStatsRequest>& acMessage) noexcept
+{
+    const auto& profiler = TickProfiler::Get();
+
+    ServerTickStats stats;
+    stats.WindowMilliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(profiler.GetReportDuration()).count();
+
+    for (const auto& entry : profiler.GetReport())
+    {
+        auto& section = stats.Sections.emplace_back();
+        section.Name = entry.Name;
+        section.Count = entry.Samples.Count;
+        section.TotalMicroseconds = entry.Samples.TotalMicroseconds;
+        section.MedianMicroseconds = entry.Samples.GetPercentile(0.5);
+        section.P99Microseconds = entry.Samples.GetPercentile(0.99);
+        section.MaxMicroseconds = entry.Samples.MaxMicroseconds;
+    }
+
+    GameServer::Get()->Send(acMessage.ConnectionId, stats);
+}
+
 void AdminService::sink_it_(const spdlog::details::log_msg& msg)
 {
     spdlog::memory_buf_t formatted;
@@ -6,6 +6,7 @@
 struct World;
 struct UpdateEvent;
 struct AdminShutdownRequest;
+struct AdminStatsRequest;
 
 /**
  * @brief Handles communication from an admin client.
@@ -19,11 +20,13 @@ public:
 
 private:
     void HandleShutdown(const AdminPacketEvent<AdminShutdownRequest>& aChanges) noexcept;
+    void HandleStatsRequest(const AdminPacketEvent<AdminStatsRequest>& acMessage) noexcept;
 
     void sink_it_(const spdlog::details::log_msg& msg) override;
     void flush_() override;
 
     Vector<String> m_messages;
     entt::scoped_connection m_shutdownConnection;
+    entt::scoped_connection m_statsConnection;
     World& m_world;
 };
@@ -5,6 +5,7 @@
 
 #include <Events/PlayerJoinEvent.h>
 #include <Events/UpdateEvent.h>
+#include <Game/TickProfiler.h>
 
 #include <Messages/ServerTimeSettings.h>
 
@@ -18,6 +19,8 @@ CalendarService::CalendarService(World& aWorld, entt::dispatcher& aDispatcher) :
 
 void CalendarService::OnUpdate(const UpdateEvent&) noexcept
 {
+    TICK_PROFILE_SCOPE("CalendarService::OnUpdate");
+
     if (!m_lastTick)
         m_lastTick = GameServer::Get()->GetTick();
 
@@ -7,7 +7,6 @@
 #include <Events/CharacterExteriorCellChangeEvent.h>
 #include <Events/CharacterInteriorCellChangeEvent.h>
 #include <Events/PlayerEnterWorldEvent.h>
-#include <Events/UpdateEvent.h>
 #include <Events/CharacterRemoveEvent.h>
 #include <Events/OwnershipTransferEvent.h>
 
@@ -44,11 +43,11 @@
 namespace
 {
 Console::Setting bEnableXpSync{"Gameplay:bEnableXpSync", "Syncs combat XP within the party", true};
+Console::Setting uSpawnBudget{"GameServer:uSpawnBudget", "Bytes of character spawns streamed to a player per tick", 8192u};
 }
 
 CharacterService::CharacterService(World& aWorld, entt::dispatcher& aDispatcher) noexcept
     : m_world(aWorld)
-    , m_updateConnection(aDispatcher.sink<UpdateEvent>().connect<&CharacterService::OnUpdate>(this))
     , m_interiorCellChangeEventConnection(aDispatcher.sink<CharacterInteriorCellChangeEvent>().connect<&CharacterService::OnCharacterInteriorCellChange>(this))
     , m_exteriorCellChangeEventConnection(aDispatcher.sink<CharacterExteriorCellChangeEvent>().connect<&CharacterService::OnCharacterExteriorCellChange>(this))
     , m_characterAssignRequestConnection(aDispatcher.sink<PacketEvent<AssignCharacterRequest>>().connect<&CharacterService::OnAssignCharacterRequest>(this))
@@ -67,17 +66,25 @@ CharacterService::CharacterService(World& aWorld, entt::dispatcher& aDispatcher)
     , m_dialogueConnection(aDispatcher.sink<PacketEvent<DialogueRequest>>().connect<&CharacterService::OnDialogueRequest>(this))
     , m_subtitleConnection(aDispatcher.sink<PacketEvent<SubtitleRequest>>().connect<&CharacterService::OnSubtitleRequest>(this))
 {
+    auto& scheduler = GameServer::Get()->GetScheduler();
+    scheduler.AddJob("CharacterService::ProcessFactionsChanges", 2000ms, [this]() { ProcessFactionsChanges(); });
+    scheduler.AddJob("CharacterService::ProcessMovementChanges", 1000ms / 50, [this]() { ProcessMovementChanges(); });
+    scheduler.AddJob("CharacterService::ProcessSpawnQueues", 1000ms / 50, [this]() { ProcessSpawnQueues(); });
 }
 
 void CharacterService::Serialize(World& aRegistry, entt::entity aEntity, CharacterSpawnRequest* apSpawnRequest) noexcept
+{
+    SerializeState(aRegistry, aEntity, apSpawnRequest);
+    SerializeContent(aRegistry, aEntity, apSpawnRequest);
+
+    apSpawnRequest->AppearanceBuffer = aRegistry.get<CharacterComponent>(aEntity).SaveBuffer;
+}
+
+void CharacterService::SerializeState(World& aRegistry, entt::entity aEntity, CharacterSpawnRequest* apSpawnRequest) noexcept
 {
     const auto& characterComponent = aRegistry.get<CharacterComponent>(aEntity);
 
     apSpawnRequest->ServerId = World::ToInteger(aEntity);
-    apSpawnRequest->AppearanceBuffer = characterComponent.SaveBuffer;
-    apSpawnRequest->ChangeFlags = characterComponent.ChangeFlags;
-    apSpawnRequest->FaceTints = characterComponent.FaceTints;
-    apSpawnRequest->FactionsContent = characterComponent.FactionsContent;
     apSpawnRequest->IsDead = characterComponent.IsDead();
     apSpawnRequest->IsPlayer = characterComponent.IsPlayer();
     apSpawnRequest->IsWeaponDrawn = characterComponent.IsWeaponDrawn();
@@ -90,18 +97,6 @@ void CharacterService::Serialize(World& aRegistry, entt::entity aEntity, Charact
         apSpawnRequest->FormId = pFormIdComponent->Id;
     }
 
-    const auto* pInventoryComponent = aRegistry.try_get<InventoryComponent>(aEntity);
-    if (pInventoryComponent)
-    {
-        apSpawnRequest->InventoryContent = pInventoryComponent->Content;
-    }
-
-    const auto* pActorValuesComponent = aRegistry.try_get<ActorValuesComponent>(aEntity);
-    if (pActorValuesComponent)
-    {
-        apSpawnRequest->InitialActorValues = pActorValuesComponent->CurrentActorValues;
-    }
-
     if (characterComponent.BaseId)
     {
         apSpawnRequest->BaseId = characterComponent.BaseId.Id;
@@ -125,10 +120,25 @@ void CharacterService::Serialize(World& aRegistry, entt::entity aEntity, Charact
     apSpawnRequest->LatestAction = animationComponent.CurrentAction;
 }
 
-void CharacterService::OnUpdate(const UpdateEvent&) const noexcept
+void CharacterService::SerializeContent(World& aRegistry, entt::entity aEntity, CharacterSpawnRequest* apSpawnRequest) noexcept
 {
-    ProcessFactionsChanges();
-    ProcessMovementChanges();
+    const auto& characterComponent = aRegistry.get<CharacterComponent>(aEntity);
+
+    apSpawnRequest->ChangeFlags = characterComponent.ChangeFlags;
+    apSpawnRequest->FaceTints = characterComponent.FaceTints;
+    apSpawnRequest->FactionsContent = characterComponent.FactionsContent;
+
+    const auto* pInventoryComponent = aRegistry.try_get<InventoryComponent>(aEntity);
+    if (pInventoryComponent)
+    {
+        apSpawnRequest->InventoryContent = pInventoryComponent->Content.GetInventory();
+    }
+
+    const auto* pActorValuesComponent = aRegistry.try_get<ActorValuesComponent>(aEntity);
+    if (pActorValuesComponent)
+    {
+        apSpawnRequest->InitialActorValues = pActorValuesComponent->CurrentActorValues;
+    }
 }
 
 void CharacterService::OnCharacterExteriorCellChange(const CharacterExteriorCellChangeEvent& acEvent) const noexcept
@@ -139,20 +149,19 @@ void CharacterService::OnCharacterExteriorCellChange(const CharacterExteriorCell
     NotifyRemoveCharacter removeMessage;
     removeMessage.ServerId = World::ToInteger(acEvent.Entity);
 
-    for (auto pPlayer : m_world.GetPlayerManager())
-    {
-        if (acEvent.Owner == pPlayer)
-            continue;
-
-        if (pPlayer->GetCellComponent().WorldSpaceId != acEvent.WorldSpaceId || pPlayer->GetCellComponent().WorldSpaceId == acEvent.WorldSpaceId && !GridCellCoords::IsCellInGridCell(acEvent.CurrentCoords, pPlayer->GetCellComponent().CenterCoords, false))
-        {
-            pPlayer->Send(removeMessage);
-        }
-        else if (pPlayer->GetCellComponent().WorldSpaceId == acEvent.WorldSpaceId && GridCellCoords::IsCellInGridCell(acEvent.CurrentCoords, pPlayer->GetCellComponent().CenterCoords, false))
-        {
-            pPlayer->Send(spawnMessage);
-        }
-    }
+    auto isInRange = [&acEvent](const Player* apPlayer) {
+        const auto& cellComponent = apPlayer->GetCellComponent();
+        return cellComponent.WorldSpaceId == acEvent.WorldSpaceId &&
+               GridCellCoords::IsCellInGridCell(acEvent.CurrentCoords, cellComponent.CenterCoords, false);
+    };
+
+    const auto* pServer = GameServer::Get();
+    pServer->Multicast(removeMessage, [&](const Player* apPlayer) {
+        return apPlayer != acEvent.Owner && !isInRange(apPlayer);
+    });
+    pServer->Multicast(spawnMessage, [&](const Player* apPlayer) {
+        return apPlayer != acEvent.Owner && isInRange(apPlayer);
+    });
 }
 
 void CharacterService::OnCharacterInteriorCellChange(const CharacterInteriorCellChangeEvent& acEvent) const noexcept
@@ -163,16 +172,13 @@ void CharacterService::OnCharacterInteriorCellChange(const CharacterInteriorCell
     NotifyRemoveCharacter removeMessage;
     removeMessage.ServerId = World::ToInteger(acEvent.Entity);
 
-    for (auto pPlayer : m_world.GetPlayerManager())
-    {
-        if (acEvent.Owner == pPlayer)
-            continue;
-
-        if (acEvent.NewCell == pPlayer->GetCellComponent().Cell)
-            pPlayer->Send(spawnMessage);
-        else
-            pPlayer->Send(removeMessage);
-    }
+    const auto* pServer = GameServer::Get();
+    pServer->Multicast(spawnMessage, [&acEvent](const Player* apPlayer) {
+        return apPlayer != acEvent.Owner && acEvent.NewCell == apPlayer->GetCellComponent().Cell;
+    });
+    pServer->Multicast(removeMessage, [&acEvent](const Player* apPlayer) {
+        return apPlayer != acEvent.Owner && acEvent.NewCell != apPlayer->GetCellComponent().Cell;
+    });
 }
 
 void CharacterService::OnAssignCharacterRequest(const PacketEvent<AssignCharacterRequest>& acMessage) const noexcept
@@ -189,26 +195,19 @@ void CharacterService::OnAssignCharacterRequest(const PacketEvent<AssignCharacte
         // Look for the character
         auto view = m_world.view<FormIdComponent, ActorValuesComponent, CharacterComponent, MovementComponent, CellIdComponent, OwnerComponent, InventoryComponent>();
 
-        const auto itor = std::find_if(
-            std::begin(view), std::end(view),
-            [view, refId](auto entity)
-            {
-                const auto& formIdComponent = view.get<FormIdComponent>(entity);
-
-                return formIdComponent.Id == refId;
-            });
+        const auto entity = m_world.FindByFormId<ActorValuesComponent, CharacterComponent, MovementComponent, CellIdComponent, OwnerComponent, InventoryComponent>(refId);
 
-        if (itor != std::end(view))
+        if (entity)
         {
             // This entity already has an owner
             spdlog::debug("FormId: {:x}:{:x} is already managed", refId.ModId, refId.BaseId);
 
-            auto& actorValuesComponent = view.get<ActorValuesComponent>(*itor);
-            auto& inventoryComponent = view.get<InventoryComponent>(*itor);
-            auto& characterComponent = view.get<CharacterComponent>(*itor);
-            auto& movementComponent = view.get<MovementComponent>(*itor);
-            auto& cellIdComponent = view.get<CellIdComponent>(*itor);
-            auto& ownerComponent = view.get<OwnerComponent>(*itor);
+            auto& actorValuesComponent = view.get<ActorValuesComponent>(*entity);
+            auto& inventoryComponent = view.get<InventoryComponent>(*entity);
+            auto& characterComponent = view.get<CharacterComponent>(*entity);
+            auto& movementComponent = view.get<MovementComponent>(*entity);
+            auto& cellIdComponent = view.get<CellIdComponent>(*entity);
+            auto& ownerComponent = view.get<OwnerComponent>(*entity);
 
             auto& partyService = m_world.GetPartyService();
 
@@ -217,22 +216,22 @@ void CharacterService::OnAssignCharacterRequest(const PacketEvent<AssignCharacte
             if (partyService.IsPlayerInParty(acMessage.pPlayer) && partyService.IsPlayerLeader(acMessage.pPlayer) && !characterComponent.IsMount())
             {
                 PartyService::Party* pParty = partyService.GetPlayerParty(acMessage.pPlayer);
-                Player* pOwningPlayer = view.get<OwnerComponent>(*itor).GetOwner();
+                Player* pOwningPlayer = view.get<OwnerComponent>(*entity).GetOwner();
 
                 // Transfer ownership if owning player is in the same party as the owner
                 if (std::find(pParty->Members.begin(), pParty->Members.end(), pOwningPlayer) != pParty->Members.end())
                 {
-                    TransferOwnership(acMessage.pPlayer, World::ToInteger(*itor));
+                    TransferOwnership(acMessage.pPlayer, World::ToInteger(*entity));
                     isOwner = true;
                 }
             }
 
             AssignCharacterResponse response{};
             response.Cookie = message.Cookie;
-            response.ServerId = World::ToInteger(*itor);
+            response.ServerId = World::ToInteger(*entity);
             response.Owner = isOwner;
             response.AllActorValues = actorValuesComponent.CurrentActorValues;
-            response.CurrentInventory = inventoryComponent.Content;
+            response.CurrentInventory = inventoryComponent.Content.GetInventory();
             response.IsDead = characterComponent.IsDead();
             response.IsWeaponDrawn = characterComponent.IsWeaponDrawn();
             response.PlayerId = characterComponent.PlayerId;
@@ -282,14 +281,16 @@ void CharacterService::OnOwnershipTransferRequest(const PacketEvent<RequestOwner
         notify.CellId = message.CellId;
         notify.Position = message.Position;
 
-        auto& cellIdComponent = m_world.get<CellIdComponent>(cEntity);
-        cellIdComponent.WorldSpaceId = message.WorldSpaceId;
-        cellIdComponent.Cell = message.CellId;
-        cellIdComponent.CenterCoords = GridCellCoords::CalculateGridCellCoords(message.Position);
+        m_world.patch<CellIdComponent>(cEntity, [&message](CellIdComponent& aCellIdComponent) {
+            aCellIdComponent.WorldSpaceId = message.WorldSpaceId;
+            aCellIdComponent.Cell = message.CellId;
+            aCellIdComponent.CenterCoords = GridCellCoords::CalculateGridCellCoords(message.Position);
+        });
 
         auto& movementComponent = m_world.get<MovementComponent>(cEntity);
         movementComponent.Position = message.Position;
-        movementComponent.Sent = true;
+        // Players that already have the character in range get the new position as a delta so their baselines stay in sync
+        movementComponent.Sent = false;
 
         GameServer::Get()->SendToPlayers(notify, acMessage.pPlayer);
     }
@@ -404,7 +405,7 @@ void CharacterService::OnRequestSpawnData(const PacketEvent<RequestSpawnData>& a
         const auto* pInventoryComponent = m_world.try_get<InventoryComponent>(*it);
         if (pInventoryComponent)
         {
-            notifySpawnData.InitialInventory = pInventoryComponent->Content;
+            notifySpawnData.InitialInventory = pInventoryComponent->Content.GetInventory();
         }
 
         notifySpawnData.IsDead = false;
@@ -425,6 +426,11 @@ void CharacterService::OnReferencesMoveRequest(const PacketEvent<ClientReference
 
     auto& message = acMessage.Packet;
 
+    auto& scriptService = m_world.GetScriptService();
+    // Most servers run without a move hook, skip the per action call entirely then
+    const bool cHasMoveHandlers = scriptService.HasHandlers(ScriptEvent::kOnCharacterMove);
+    const auto& navMeshService = m_world.GetNavMeshService();
+
     for (auto& entry : message.Updates)
     {
         const auto entity = static_cast<entt::entity>(entry.first);
@@ -436,31 +442,41 @@ void CharacterService::OnReferencesMoveRequest(const PacketEvent<ClientReference
             continue;
         }
 
+        auto& update = entry.second;
+        auto& movement = update.UpdatedMovement;
+
+        if (!navMeshService.IsPlausiblePosition(movement.WorldSpaceId, movement.Position))
+        {
+            spdlog::debug("{:x} moved {:x} too far from the navmesh, update dropped", acMessage.pPlayer->GetConnectionId(), World::ToInteger(entity));
+            continue;
+        }
+
         auto& movementComponent = view.get<MovementComponent>(*itor);
-        auto& cellIdComponent = view.get<CellIdComponent>(*itor);
         auto& animationComponent = view.get<AnimationComponent>(*itor);
 
         movementComponent.Tick = message.Tick;
 
         const auto movementCopy = movementComponent;
 
-        auto& update = entry.second;
-        auto& movement = update.UpdatedMovement;
-
         movementComponent.Position = movement.Position;
         movementComponent.Rotation = glm::vec3(movement.Rotation.x, 0.f, movement.Rotation.y);
         movementComponent.Variables = movement.Variables;
         movementComponent.Direction = movement.Direction;
 
-        cellIdComponent.Cell = movement.CellId;
-        cellIdComponent.WorldSpaceId = movement.WorldSpaceId;
-        cellIdComponent.CenterCoords = GridCellCoords::CalculateGridCellCoords(movement.Position.x, movement.Position.y);
+        m_world.patch<CellIdComponent>(*itor, [&movement](CellIdComponent& aCellIdComponent) {
+            aCellIdComponent.Cell = movement.CellId;
+            aCellIdComponent.WorldSpaceId = movement.WorldSpaceId;
+            aCellIdComponent.CenterCoords = GridCellCoords::CalculateGridCellCoords(movement.Position.x, movement.Position.y);
+        });
 
         for (auto& action : update.ActionEvents)
         {
-            auto [canceled, reason] = GameServer::Get()->GetWorld().GetScriptService().HandleCharacterMove(entity);
-            if (canceled)
-                continue;
+            if (cHasMoveHandlers)
+            {
+                auto [canceled, reason] = scriptService.HandleCharacterMove(entity);
+                if (canceled)
+                    continue;
+            }
 
             animationComponent.CurrentAction = action;
 
@@ -487,6 +503,7 @@ void CharacterService::OnFactionsChanges(const PacketEvent<RequestFactionsChange
         auto& characterComponent = view.get<CharacterComponent>(*it);
         characterComponent.FactionsContent = factions;
         characterComponent.SetDirtyFactions(true);
+        characterComponent.SetDirtySpawnCache(true);
     }
 }
 
@@ -610,13 +627,6 @@ void CharacterService::CreateCharacter(const PacketEvent<AssignCharacterRequest>
 
     m_world.emplace<OwnerComponent>(cEntity, acMessage.pPlayer);
 
-    auto& cellIdComponent = m_world.emplace<CellIdComponent>(cEntity, message.CellId);
-    if (message.WorldSpaceId != GameId{})
-    {
-        cellIdComponent.WorldSpaceId = message.WorldSpaceId;
-        cellIdComponent.CenterCoords = GridCellCoords::CalculateGridCellCoords(message.Position);
-    }
-
     auto& characterComponent = m_world.emplace<CharacterComponent>(cEntity);
     characterComponent.ChangeFlags = message.ChangeFlags;
     characterComponent.SaveBuffer = std::move(message.AppearanceBuffer);
@@ -630,12 +640,23 @@ void CharacterService::CreateCharacter(const PacketEvent<AssignCharacterRequest>
     characterComponent.SetMount(message.IsMount);
     characterComponent.SetPlayerSummon(message.IsPlayerSummon);
 
+    // Emplaced once fully built and after the character component so the interest grid sees the final location
+    CellIdComponent cellIdComponent{message.CellId};
+    if (message.WorldSpaceId != GameId{})
+    {
+        cellIdComponent.WorldSpaceId = message.WorldSpaceId;
+        cellIdComponent.CenterCoords = GridCellCoords::CalculateGridCellCoords(message.Position);
+    }
+    m_world.emplace<CellIdComponent>(cEntity, cellIdComponent);
+
     auto& inventoryComponent = m_world.emplace<InventoryComponent>(cEntity);
     inventoryComponent.Content = message.InventoryContent;
 
     auto& actorValuesComponent = m_world.emplace<ActorValuesComponent>(cEntity);
     actorValuesComponent.CurrentActorValues = message.AllActorValues;
 
+    m_world.emplace<SpawnCacheComponent>(cEntity);
+
     spdlog::debug("FormId: {:x}:{:x} - NpcId: {:x}:{:x} assigned to {:x}", gameId.ModId, gameId.BaseId, baseId.ModId, baseId.BaseId, acMessage.pPlayer->GetConnectionId());
 
     auto& movementComponent = m_world.emplace<MovementComponent>(cEntity);
@@ -700,111 +721,103 @@ void CharacterService::TransferOwnership(Player* apPlayer, const uint32_t acServ
 
 void CharacterService::ProcessFactionsChanges() const noexcept
 {
-    static std::chrono::steady_clock::time_point lastSendTimePoint;
-    constexpr auto cDelayBetweenSnapshots = 2000ms;
-
-    const auto now = std::chrono::steady_clock::now();
-    if (now - lastSendTimePoint < cDelayBetweenSnapshots)
-        return;
-
-    lastSendTimePoint = now;
-
     const auto characterView = m_world.view<CellIdComponent, CharacterComponent, OwnerComponent>();
+    const auto& map = m_world.GetMap();
 
-    TiltedPhoques::Map<Player*, NotifyFactionsChanges> messages;
-
-    for (auto entity : characterView)
+    for (auto pPlayer : m_world.GetPlayerManager())
     {
-        auto& characterComponent = characterView.get<CharacterComponent>(entity);
-        auto& cellIdComponent = characterView.get<CellIdComponent>(entity);
-        auto& ownerComponent = characterView.get<OwnerComponent>(entity);
-
-        // If we have nothing new to send skip this
-        if (characterComponent.IsDirtyFactions())
-            continue;
+        NotifyFactionsChanges message;
 
-        for (auto pPlayer : m_world.GetPlayerManager())
-        {
-            if (pPlayer == ownerComponent.GetOwner())
-                continue;
+        map.ForEachEntityInRange(pPlayer->GetCellComponent(), [&](entt::entity aEntity) {
+            if (!characterView.contains(aEntity))
+                return;
 
-            if (!cellIdComponent.IsInRange(pPlayer->GetCellComponent(), characterComponent.IsDragon()))
-                continue;
+            const auto& characterComponent = characterView.get<CharacterComponent>(aEntity);
 
-            auto& message = messages[pPlayer];
-            auto& change = message.Changes[World::ToInteger(entity)];
+            // If we have nothing new to send skip this
+            if (characterComponent.IsDirtyFactions())
+                return;
 
-            change = characterComponent.FactionsContent;
-        }
+            if (pPlayer == characterView.get<OwnerComponent>(aEntity).GetOwner())
+                return;
 
-        characterComponent.SetDirtyFactions(false);
-    }
+            message.Changes[World::ToInteger(aEntity)] = characterComponent.FactionsContent;
+        });
 
-    for (auto [pPlayer, message] : messages)
-    {
         if (!message.Changes.empty())
             pPlayer->Send(message);
     }
 }
 
-void CharacterService::ProcessMovementChanges() const noexcept
+void CharacterService::ProcessMovementChanges() noexcept
 {
-    static std::chrono::steady_clock::time_point lastSendTimePoint;
-    constexpr auto cDelayBetweenSnapshots = 1000ms / 50;
-
-    const auto now = std::chrono::steady_clock::now();
-    if (now - lastSendTimePoint < cDelayBetweenSnapshots)
-        return;
-
-    lastSendTimePoint = now;
-
     const auto characterView = m_world.view<CharacterComponent, CellIdComponent, MovementComponent, AnimationComponent, OwnerComponent>();
+    const auto& map = m_world.GetMap();
+    const auto tick = GameServer::Get()->GetTick();
 
-    TiltedPhoques::Map<Player*, ServerReferencesMoveRequest> messages;
+    m_snapshotBuilder.BeginTick();
+    m_snapshot.Tick = tick;
 
     for (auto pPlayer : m_world.GetPlayerManager())
     {
-        auto& message = messages[pPlayer];
+        auto& baselines = pPlayer->GetMovementBaselines();
 
-        message.Tick = GameServer::Get()->GetTick();
-    }
+        m_snapshotSlices.clear();
 
-    for (auto entity : characterView)
-    {
-        auto& characterComponent = characterView.get<CharacterComponent>(entity);
-        auto& movementComponent = characterView.get<MovementComponent>(entity);
-        auto& cellIdComponent = characterView.get<CellIdComponent>(entity);
-        auto& ownerComponent = characterView.get<OwnerComponent>(entity);
-        auto& animationComponent = characterView.get<AnimationComponent>(entity);
-
-        // If we have nothing new to send skip this
-        if (movementComponent.Sent == true)
-            continue;
+        map.ForEachEntityInRange(pPlayer->GetCellComponent(), [&](entt::entity aEntity) {
+            if (!characterView.contains(aEntity))
+                return;
 
-        for (auto pPlayer : m_world.GetPlayerManager())
-        {
-            if (pPlayer == ownerComponent.GetOwner())
-                continue;
+            if (pPlayer == characterView.get<OwnerComponent>(aEntity).GetOwner())
+                return;
 
-            if (!cellIdComponent.IsInRange(pPlayer->GetCellComponent(), characterComponent.IsDragon()))
-                continue;
+            const auto cServerId = World::ToInteger(aEntity);
+
+            auto [baselineItor, isNew] = baselines.try_emplace(cServerId, tick);
+            baselineItor.value() = tick;
+
+            const auto& movementComponent = characterView.get<MovementComponent>(aEntity);
 
-            auto& message = messages[pPlayer];
-            auto& update = message.Updates[World::ToInteger(entity)];
-            auto& movement = update.UpdatedMovement;
+            // If we have nothing new to send skip this, unless the player has nothing to apply deltas to
+            const auto slice = m_snapshotBuilder.Get(cServerId, isNew, movementComponent.Sent == false,
+                [&](Movement& aMovement) -> const Vector<ActionEvent>& {
+                    aMovement.Position = movementComponent.Position;
 
-            movement.Position = movementComponent.Position;
+                    aMovement.Rotation.x = movementComponent.Rotation.x;
+                    aMovement.Rotation.y = movementComponent.Rotation.z;
 
-            movement.Rotation.x = movementComponent.Rotation.x;
-            movement.Rotation.y = movementComponent.Rotation.z;
+                    aMovement.Direction = movementComponent.Direction;
+                    aMovement.Variables = movementComponent.Variables;
 
-            movement.Direction = movementComponent.Direction;
-            movement.Variables = movementComponent.Variables;
+                    return characterView.get<AnimationComponent>(aEntity).Actions;
+                });
 
-            update.ActionEvents = animationComponent.Actions;
+            if (slice)
+                m_snapshotSlices.emplace_back(cServerId, slice);
+        });
+
+        // References that left the player's range start over from a keyframe when they come back
+        for (auto itor = std::begin(baselines); itor != std::end(baselines);)
+        {
+            if (itor->second != tick)
+                itor = baselines.erase(itor);
+            else
+                ++itor;
         }
+
+        if (m_snapshotSlices.empty())
+            continue;
+
+        // Slices are resolved last as encoding more references may move the builder's storage
+        m_snapshot.EncodedUpdates.clear();
+        for (const auto& [serverId, slice] : m_snapshotSlices)
+            m_snapshot.EncodedUpdates.push_back({serverId, m_snapshotBuilder.GetData(slice)});
+
+        pPlayer->Send(m_snapshot);
     }
 
+    m_snapshotBuilder.EndTick();
+
     m_world.view<AnimationComponent>().each(
         [](AnimationComponent& animationComponent)
         {
@@ -815,10 +828,103 @@ void CharacterService::ProcessMovementChanges() const noexcept
         });
 
     m_world.view<MovementComponent>().each([](MovementComponent& movementComponent) { movementComponent.Sent = true; });
+}
 
-    for (auto& [pPlayer, message] : messages)
+void CharacterService::ProcessSpawnQueues() noexcept
+{
+    const size_t cBudget = uSpawnBudget.value_as<uint32_t>();
+
+    // A batch stops once it goes over budget, a single spawn more always fits so the spans below stay valid
+    m_spawnBytes.reserve(cBudget + CharacterSpawnBatchRequest::kMaxSpawnSize);
+
+    for (auto pPlayer : m_world.GetPlayerManager())
     {
-        if (!message.Updates.empty())
-            pPlayer->Send(message);
+        auto& pendingSpawns = pPlayer->GetPendingSpawns();
+        if (pendingSpawns.empty())
+            continue;
+
+        m_spawnBatch.AppearanceViews.clear();
+        m_spawnBatch.EncodedSpawns.clear();
+        m_spawnBytes.clear();
+
+        // Views and spans point into the character components, nothing is added to the world while the batch is built
+        TiltedPhoques::Map<std::string_view, uint32_t> appearanceIds;
+
+        size_t batchSize = 0;
+        size_t processed = 0;
+        for (; processed < pendingSpawns.size() && batchSize < cBudget; ++processed)
+        {
+            const auto cEntity = pendingSpawns[processed];
+
+            // The character may have been removed or handed over to this player while it was queued
+            if (!m_world.valid(cEntity) || !m_world.all_of<CellIdComponent, CharacterComponent, OwnerComponent, SpawnCacheComponent>(cEntity))
+                continue;
+
+            if (m_world.get<OwnerComponent>(cEntity).GetOwner() == pPlayer)
+                continue;
+
+            // Either side may have changed cells since the character was queued
+            if (!pPlayer->GetCellComponent().IsInRange(m_world.get<CellIdComponent>(cEntity), m_world.get<CharacterComponent>(cEntity).IsDragon()))
+                continue;
+
+            const auto cContent = GetSpawnContent(cEntity);
+
+            CharacterSpawnRequest spawn;
+            SerializeState(m_world, cEntity, &spawn);
+
+            Buffer::Writer writer(&m_spawnBuffer);
+            spawn.SerializeState(writer);
+            const size_t cSize = writer.Size();
+
+            const std::string_view cAppearance = m_world.get<CharacterComponent>(cEntity).SaveBuffer;
+            const auto [itor, inserted] = appearanceIds.try_emplace(cAppearance, static_cast<uint32_t>(m_spawnBatch.AppearanceViews.size()));
+            if (inserted)
+            {
+                batchSize += cAppearance.size();
+                m_spawnBatch.AppearanceViews.push_back(cAppearance);
+            }
+
+            const size_t cOffset = m_spawnBytes.size();
+            m_spawnBytes.insert(std::end(m_spawnBytes), m_spawnBuffer.GetWriteData(), m_spawnBuffer.GetWriteData() + cSize);
+            m_spawnBatch.EncodedSpawns.push_back({itor->second, {m_spawnBytes.data() + cOffset, cSize}, cContent});
+
+            batchSize += cSize + cContent.size();
+        }
+
+        pendingSpawns.erase(std::begin(pendingSpawns), std::begin(pendingSpawns) + processed);
+
+        if (!m_spawnBatch.EncodedSpawns.empty())
+            pPlayer->Send(m_spawnBatch);
     }
 }
+
+std::span<const uint8_t> CharacterService::GetSpawnContent(entt::entity aEntity) noexcept
+{
+    auto& cacheComponent = m_world.get<SpawnCacheComponent>(aEntity);
+    auto& characterComponent = m_world.get<CharacterComponent>(aEntity);
+    auto* pInventoryComponent = m_world.try_get<InventoryComponent>(aEntity);
+    auto* pActorValuesComponent = m_world.try_get<ActorValuesComponent>(aEntity);
+
+    const bool cDirty = cacheComponent.Content.empty() || characterComponent.IsDirtySpawnCache() ||
+                        (pInventoryComponent && pInventoryComponent->IsDirtySpawnCache) ||
+                        (pActorValuesComponent && pActorValuesComponent->IsDirtySpawnCache);
+
+    if (cDirty)
+    {
+        CharacterSpawnRequest spawn;
+        SerializeContent(m_world, aEntity, &spawn);
+
+        Buffer::Writer writer(&m_spawnBuffer);
+        spawn.SerializeContent(writer);
+
+        cacheComponent.Content.assign(m_spawnBuffer.GetWriteData(), m_spawnBuffer.GetWriteData() + writer.Size());
+
+        characterComponent.SetDirtySpawnCache(false);
+        if (pInventoryComponent)
+            pInventoryComponent->IsDirtySpawnCache = false;
+        if (pActorValuesComponent)
+            pActorValuesComponent->IsDirtySpawnCache = false;
+    }
+
+    return cacheComponent.Content;
+}
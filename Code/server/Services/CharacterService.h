@@ -1,8 +1,10 @@
 #pragma once
 
 #include <Events/PacketEvent.h>
+#include <Game/SnapshotBuilder.h>
+#include <Messages/ServerReferencesMoveRequest.h>
+#include <Messages/CharacterSpawnBatchRequest.h>
 
-struct UpdateEvent;
 struct CharacterInteriorCellChangeEvent;
 struct CharacterSpawnedEvent;
 struct World;
@@ -35,9 +37,11 @@ struct CharacterService
     TP_NOCOPYMOVE(CharacterService);
 
     static void Serialize(World& aRegistry, entt::entity aEntity, CharacterSpawnRequest* apSpawnRequest) noexcept;
+    // Fill the parts of the spawn written by CharacterSpawnRequest::SerializeState and SerializeContent
+    static void SerializeState(World& aRegistry, entt::entity aEntity, CharacterSpawnRequest* apSpawnRequest) noexcept;
+    static void SerializeContent(World& aRegistry, entt::entity aEntity, CharacterSpawnRequest* apSpawnRequest) noexcept;
 
 protected:
-    void OnUpdate(const UpdateEvent& acEvent) const noexcept;
     void OnCharacterExteriorCellChange(const CharacterExteriorCellChangeEvent& acEvent) const noexcept;
     void OnCharacterInteriorCellChange(const CharacterInteriorCellChangeEvent& acEvent) const noexcept;
     void OnAssignCharacterRequest(const PacketEvent<AssignCharacterRequest>& acMessage) const noexcept;
@@ -60,12 +64,29 @@ protected:
     void TransferOwnership(Player* apPlayer, const uint32_t acServerId) const noexcept;
 
     void ProcessFactionsChanges() const noexcept;
-    void ProcessMovementChanges() const noexcept;
+    void ProcessMovementChanges() noexcept;
+    /**
+     * @brief Sends each player the characters queued by a cell change, within a per tick byte budget.
+     */
+    void ProcessSpawnQueues() noexcept;
+    /**
+     * @brief Returns the encoded spawn content of a character, only encoded again once it changed.
+     */
+    std::span<const uint8_t> GetSpawnContent(entt::entity aEntity) noexcept;
 
 private:
     World& m_world;
 
-    entt::scoped_connection m_updateConnection;
+    // Kept across ticks so building snapshots does not allocate once warmed up
+    SnapshotBuilder m_snapshotBuilder;
+    ServerReferencesMoveRequest m_snapshot;
+    Vector<std::pair<uint32_t, SnapshotBuilder::Slice>> m_snapshotSlices;
+
+    CharacterSpawnBatchRequest m_spawnBatch;
+    Buffer m_spawnBuffer{CharacterSpawnBatchRequest::kMaxSpawnSize};
+    // Encoded spawn states of the batch being built, contents come from the characters' caches
+    Vector<uint8_t> m_spawnBytes;
+
     entt::scoped_connection m_exteriorCellChangeEventConnection;
     entt::scoped_connection m_interiorCellChangeEventConnection;
     entt::scoped_connection m_characterAssignRequestConnection;
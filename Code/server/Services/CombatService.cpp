@@ -58,6 +58,6 @@ void CombatService::OnProjectileLaunchRequest(const PacketEvent<ProjectileLaunch
     notify.IgnoreNearCollisions = packet.IgnoreNearCollisions;
 
     const auto cShooterEntity = static_cast<entt::entity>(packet.ShooterID);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, cShooterEntity, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+    if (!GameServer::Get()->QueueToPlayersInRange(notify, cShooterEntity, acMessage.GetSender()))
+        spdlog::error("{}: QueueToPlayersInRange failed", __FUNCTION__);
 }
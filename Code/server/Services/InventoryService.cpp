@@ -36,6 +36,7 @@ void InventoryService::OnInventoryChanges(const PacketEvent<RequestInventoryChan
     {
         auto& inventoryComponent = view.get<InventoryComponent>(*it);
         inventoryComponent.Content.AddOrRemoveEntry(message.Item);
+        inventoryComponent.IsDirtySpawnCache = true;
     }
 
     if (!message.UpdateClients)
@@ -48,8 +49,8 @@ void InventoryService::OnInventoryChanges(const PacketEvent<RequestInventoryChan
     notify.Drop = bEnableItemDrops ? message.Drop : false;
 
     const entt::entity cOrigin = static_cast<entt::entity>(message.ServerId);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, cOrigin, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+    if (!GameServer::Get()->QueueToPlayersInRange(notify, cOrigin, acMessage.GetSender()))
+        spdlog::error("{}: QueueToPlayersInRange failed", __FUNCTION__);
 }
 
 void InventoryService::OnEquipmentChanges(const PacketEvent<RequestEquipmentChanges>& acMessage) noexcept
@@ -64,6 +65,7 @@ void InventoryService::OnEquipmentChanges(const PacketEvent<RequestEquipmentChan
     {
         auto& inventoryComponent = view.get<InventoryComponent>(*it);
         inventoryComponent.Content.UpdateEquipment(message.CurrentInventory);
+        inventoryComponent.IsDirtySpawnCache = true;
     }
 
     NotifyEquipmentChanges notify;
@@ -76,8 +78,8 @@ void InventoryService::OnEquipmentChanges(const PacketEvent<RequestEquipmentChan
     notify.IsShout = message.IsShout;
 
     const entt::entity cOrigin = static_cast<entt::entity>(message.ServerId);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, cOrigin, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+    if (!GameServer::Get()->QueueToPlayersInRange(notify, cOrigin, acMessage.GetSender()))
+        spdlog::error("{}: QueueToPlayersInRange failed", __FUNCTION__);
 }
 
 void InventoryService::OnWeaponDrawnRequest(const PacketEvent<DrawWeaponRequest>& acMessage) noexcept
@@ -31,8 +31,8 @@ void MagicService::OnSpellCastRequest(const PacketEvent<SpellCastRequest>& acMes
     notify.DesiredTarget = message.DesiredTarget;
 
     const auto entity = static_cast<entt::entity>(message.CasterId);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, entity, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+    if (!GameServer::Get()->QueueToPlayersInRange(notify, entity, acMessage.GetSender()))
+        spdlog::error("{}: QueueToPlayersInRange failed", __FUNCTION__);
 }
 
 void MagicService::OnInterruptCastRequest(const PacketEvent<InterruptCastRequest>& acMessage) const noexcept
@@ -44,8 +44,8 @@ void MagicService::OnInterruptCastRequest(const PacketEvent<InterruptCastRequest
     notify.CastingSource = message.CastingSource;
 
     const auto entity = static_cast<entt::entity>(message.CasterId);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, entity, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+    if (!GameServer::Get()->QueueToPlayersInRange(notify, entity, acMessage.GetSender()))
+        spdlog::error("{}: QueueToPlayersInRange failed", __FUNCTION__);
 }
 
 void MagicService::OnAddTargetRequest(const PacketEvent<AddTargetRequest>& acMessage) const noexcept
@@ -59,6 +59,6 @@ void MagicService::OnAddTargetRequest(const PacketEvent<AddTargetRequest>& acMes
     notify.Magnitude = message.Magnitude;
 
     const auto entity = static_cast<entt::entity>(message.TargetId);
-    if (!GameServer::Get()->SendToPlayersInRange(notify, entity, acMessage.GetSender()))
-        spdlog::error("{}: SendToPlayersInRange failed", __FUNCTION__);
+    if (!GameServer::Get()->QueueToPlayersInRange(notify, entity, acMessage.GetSender()))
+        spdlog::error("{}: QueueToPlayersInRange failed", __FUNCTION__);
 }
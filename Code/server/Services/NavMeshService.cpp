@@ -0,0 +1,128 @@
+#include <Services/NavMeshService.h>
+
+#include <Components.h>
+#include <World.h>
+
+#include <es_loader/ESLoader.h>
+#include <es_loader/NavMeshQuery.h>
+
+namespace
+{
+Console::Setting bValidateMovement{"Gameplay:bValidateMovement", "Drops exterior movement that is too far from any navmesh", false};
+Console::Setting fMaxNavMeshDistance{"Gameplay:fMaxNavMeshDistance", "Distance from the navmesh above which exterior movement is dropped",
+                                     2048.f};
+} // namespace
+
+NavMeshService::NavMeshService(World& aWorld) noexcept
+    : m_world(aWorld)
+{
+    Build();
+}
+
+NavMeshService::~NavMeshService() noexcept = default;
+
+const ESLoader::NavMeshQuery* NavMeshService::GetQuery(const GameId& acWorldSpaceId) const noexcept
+{
+    if (!acWorldSpaceId || m_queries.empty())
+        return nullptr;
+
+    const auto itor = m_queries.find(ResolveWorldSpace(acWorldSpaceId));
+    if (itor == std::end(m_queries))
+        return nullptr;
+
+    return itor->second.get();
+}
+
+bool NavMeshService::IsPlausiblePosition(const GameId& acWorldSpaceId, const glm::vec3& acPosition) const noexcept
+{
+    if (!bValidateMovement)
+        return true;
+
+    // Nothing to check against, the client is trusted like before
+    const auto* pQuery = GetQuery(acWorldSpaceId);
+    if (!pQuery)
+        return true;
+
+    return pQuery->FindNearest(acPosition, fMaxNavMeshDistance.as_float()).has_value();
+}
+
+std::optional<glm::vec3> NavMeshService::FindSpawnPoint(const GameId& acWorldSpaceId, const glm::vec3& acPosition, float aMaxDistance) const noexcept
+{
+    const auto* pQuery = GetQuery(acWorldSpaceId);
+    if (!pQuery)
+        return std::nullopt;
+
+    const auto cHit = pQuery->FindNearest(acPosition, aMaxDistance);
+    if (!cHit)
+        return std::nullopt;
+
+    return cHit->Position;
+}
+
+bool NavMeshService::IsReachable(const GameId& acWorldSpaceId, const glm::vec3& acFrom, const glm::vec3& acTo, float aMaxDistance) const noexcept
+{
+    const auto* pQuery = GetQuery(acWorldSpaceId);
+    if (!pQuery)
+        return false;
+
+    const auto cFrom = pQuery->FindNearest(acFrom, aMaxDistance);
+    const auto cTo = pQuery->FindNearest(acTo, aMaxDistance);
+
+    return cFrom && cTo && pQuery->IsReachable(cFrom->Triangle, cTo->Triangle);
+}
+
+void NavMeshService::Build() noexcept
+{
+    const auto* pRecordCollection = m_world.GetRecordCollection();
+    if (!pRecordCollection)
+        return;
+
+    const auto cStart = std::chrono::steady_clock::now();
+
+    size_t triangleCount = 0;
+    size_t memoryUsage = 0;
+
+    const auto& worlds = pRecordCollection->GetWorlds();
+    for (size_t i = 0; i < worlds.Size(); ++i)
+    {
+        const auto& world = worlds.GetRecord(i);
+        if (world.m_navMeshRefs.empty())
+            continue;
+
+        auto pQuery = MakeUnique<ESLoader::NavMeshQuery>(world.m_navMeshRefs);
+        if (pQuery->IsEmpty())
+            continue;
+
+        triangleCount += pQuery->GetTriangleCount();
+        memoryUsage += pQuery->GetMemoryUsage();
+
+        m_queries[worlds.GetId(i)] = std::move(pQuery);
+    }
+
+    const auto cDuration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - cStart);
+    spdlog::info("Indexed {} navmesh triangles of {} world spaces in {} ms, {} KiB", triangleCount, m_queries.size(), cDuration.count(),
+                 memoryUsage / 1024);
+}
+
+uint32_t NavMeshService::ResolveWorldSpace(const GameId& acWorldSpaceId) const noexcept
+{
+    const auto itor = m_worldSpaceIds.find(acWorldSpaceId);
+    if (itor != std::end(m_worldSpaceIds))
+        return itor->second;
+
+    // Clients send ids relative to the mod ids the server gave them, records use the server's load order
+    String filename;
+    bool isLite = false;
+    if (!m_world.ctx().at<ModsComponent>().GetFilename(acWorldSpaceId.ModId, filename, isLite))
+        return 0;
+
+    const uint32_t cMask = isLite ? 0x00000FFF : 0x00FFFFFF;
+    const auto cPrefix = m_world.GetRecordCollection()->GetFormIdPrefix(filename);
+    const uint32_t cFormId = cPrefix ? *cPrefix + (acWorldSpaceId.BaseId & cMask) : 0;
+
+    // Ids come from clients, only the few that name a world space we can query are kept
+    if ((acWorldSpaceId.BaseId & ~cMask) == 0 && m_queries.find(cFormId) != std::end(m_queries))
+        m_worldSpaceIds[acWorldSpaceId] = cFormId;
+
+    return cFormId;
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <Structs/GameId.h>
+
+struct World;
+
+namespace ESLoader
+{
+class NavMeshQuery;
+}
+
+/**
+ * @brief Answers navmesh queries of exterior world spaces without asking a client.
+ *
+ * Queries are built once from the navmeshes of the record collection, servers running without game data have
+ * none and every position is then considered valid. Positions are only checked in exteriors, interior cells are
+ * not indexed. Game thread only, resolved world space ids are cached.
+ */
+struct NavMeshService
+{
+    explicit NavMeshService(World& aWorld) noexcept;
+    ~NavMeshService() noexcept;
+
+    TP_NOCOPYMOVE(NavMeshService);
+
+    /**
+     * @brief Returns the query of a world space, nullptr if it has no navmesh.
+     */
+    [[nodiscard]] const ESLoader::NavMeshQuery* GetQuery(const GameId& acWorldSpaceId) const noexcept;
+
+    /**
+     * @brief Checks a position sent by a client against the navmesh, when movement validation is enabled.
+     */
+    [[nodiscard]] bool IsPlausiblePosition(const GameId& acWorldSpaceId, const glm::vec3& acPosition) const noexcept;
+    /**
+     * @brief Returns the point of the navmesh closest to acPosition, to spawn or teleport a character on the ground.
+     */
+    [[nodiscard]] std::optional<glm::vec3> FindSpawnPoint(const GameId& acWorldSpaceId, const glm::vec3& acPosition,
+                                                          float aMaxDistance) const noexcept;
+    /**
+     * @brief Returns true if a character can walk from one position to the other, both must be near the navmesh.
+     */
+    [[nodiscard]] bool IsReachable(const GameId& acWorldSpaceId, const glm::vec3& acFrom, const glm::vec3& acTo,
+                                   float aMaxDistance) const noexcept;
+
+private:
+    void Build() noexcept;
+    [[nodiscard]] uint32_t ResolveWorldSpace(const GameId& acWorldSpaceId) const noexcept;
+
+    World& m_world;
+
+    // Keyed by the form id of the world space in the server's load order
+    TiltedPhoques::Map<uint32_t, UniquePtr<ESLoader::NavMeshQuery>> m_queries;
+    // Client ids of the world spaces in m_queries, other ids are resolved on every call
+    mutable TiltedPhoques::Map<GameId, uint32_t> m_worldSpaceIds;
+};
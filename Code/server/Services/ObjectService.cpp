@@ -65,27 +65,21 @@ void ObjectService::OnAssignObjectsRequest(const PacketEvent<AssignObjectsReques
 
     for (const ObjectData& object : acMessage.Packet.Objects)
     {
-        const auto iter = std::find_if(
-            std::begin(view), std::end(view),
-            [view, id = object.Id](auto entity)
-            {
-                const auto& formIdComponent = view.get<FormIdComponent>(entity);
-                return formIdComponent.Id == id;
-            });
-
-        if (iter != std::end(view))
+        const auto entity = m_world.FindByFormId<ObjectComponent, InventoryComponent>(object.Id);
+
+        if (entity)
         {
             ObjectData objectData;
-            objectData.ServerId = World::ToInteger(*iter);
+            objectData.ServerId = World::ToInteger(*entity);
 
-            auto& formIdComponent = view.get<FormIdComponent>(*iter);
+            auto& formIdComponent = view.get<FormIdComponent>(*entity);
             objectData.Id = formIdComponent.Id;
 
-            auto& objectComponent = view.get<ObjectComponent>(*iter);
+            auto& objectComponent = view.get<ObjectComponent>(*entity);
             objectData.CurrentLockData = objectComponent.CurrentLockData;
 
-            auto& inventoryComponent = view.get<InventoryComponent>(*iter);
-            objectData.CurrentInventory = inventoryComponent.Content;
+            auto& inventoryComponent = view.get<InventoryComponent>(*entity);
+            objectData.CurrentInventory = inventoryComponent.Content.GetInventory();
 
             objectData.IsSenderFirst = false;
 
@@ -123,13 +117,9 @@ void ObjectService::OnActivate(const PacketEvent<ActivateRequest>& acMessage) co
     notifyActivate.Id = acMessage.Packet.Id;
     notifyActivate.ActivatorId = acMessage.Packet.ActivatorId;
 
-    for (auto pPlayer : m_world.GetPlayerManager())
-    {
-        if (pPlayer != acMessage.pPlayer && pPlayer->GetCellComponent().Cell == acMessage.Packet.CellId)
-        {
-            pPlayer->Send(notifyActivate);
-        }
-    }
+    GameServer::Get()->Multicast(notifyActivate, [&acMessage](const Player* apPlayer) {
+        return apPlayer != acMessage.pPlayer && apPlayer->GetCellComponent().Cell == acMessage.Packet.CellId;
+    });
 }
 
 void ObjectService::OnLockChange(const PacketEvent<LockChangeRequest>& acMessage) const noexcept
@@ -139,31 +129,16 @@ void ObjectService::OnLockChange(const PacketEvent<LockChangeRequest>& acMessage
     notifyLockChange.IsLocked = acMessage.Packet.IsLocked;
     notifyLockChange.LockLevel = acMessage.Packet.LockLevel;
 
-    auto objectView = m_world.view<FormIdComponent, ObjectComponent>();
-
-    const auto iter = std::find_if(
-        std::begin(objectView), std::end(objectView),
-        [objectView, id = acMessage.Packet.Id](auto entity)
-        {
-            const auto& formIdComponent = objectView.get<FormIdComponent>(entity);
-            return formIdComponent.Id == id;
-        });
-
-    if (iter != std::end(objectView))
+    if (const auto entity = m_world.FindByFormId<ObjectComponent>(acMessage.Packet.Id))
     {
-        auto& objectComponent = objectView.get<ObjectComponent>(*iter);
+        auto& objectComponent = m_world.get<ObjectComponent>(*entity);
         objectComponent.CurrentLockData.IsLocked = acMessage.Packet.IsLocked;
         objectComponent.CurrentLockData.LockLevel = acMessage.Packet.LockLevel;
     }
 
-    for (Player* pPlayer : m_world.GetPlayerManager())
-    {
-        if (pPlayer == acMessage.pPlayer)
-            continue;
-
-        if (pPlayer->GetCellComponent().Cell == acMessage.Packet.CellId)
-            pPlayer->Send(notifyLockChange);
-    }
+    GameServer::Get()->Multicast(notifyLockChange, [&acMessage](const Player* apPlayer) {
+        return apPlayer != acMessage.pPlayer && apPlayer->GetCellComponent().Cell == acMessage.Packet.CellId;
+    });
 }
 
 void ObjectService::OnScriptAnimationRequest(const PacketEvent<ScriptAnimationRequest>& acMessage) noexcept
@@ -175,8 +150,5 @@ void ObjectService::OnScriptAnimationRequest(const PacketEvent<ScriptAnimationRe
     message.Animation = packet.Animation;
     message.EventName = packet.EventName;
 
-    for (Player* pPlayer : m_world.GetPlayerManager())
-    {
-        pPlayer->Send(message);
-    }
+    GameServer::Get()->SendToPlayers(message);
 }
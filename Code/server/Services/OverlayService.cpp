@@ -3,6 +3,7 @@
 #include <Services/OverlayService.h>
 
 #include <ChatMessageTypes.h>
+#include <ChatSanitizer.h>
 
 #include <Messages/NotifyChatMessageBroadcast.h>
 #include <Messages/SendChatMessageRequest.h>
@@ -15,9 +16,6 @@
 
 #include "Game/Player.h"
 
-#include <regex>
-
-
 OverlayService::OverlayService(World& aWorld, entt::dispatcher& aDispatcher)
     : m_world(aWorld)
 {
@@ -27,14 +25,13 @@ OverlayService::OverlayService(World& aWorld, entt::dispatcher& aDispatcher)
     m_playerHealthConnection = aDispatcher.sink<PacketEvent<RequestPlayerHealthUpdate>>().connect<&OverlayService::OnPlayerHealthUpdate>(this);
 }
 
-void sendPlayerMessage(const ChatMessageType acType, const String acContent, Player* aSendingPlayer) noexcept
+void sendPlayerMessage(const ChatMessageType acType, const String& acContent, Player* aSendingPlayer) noexcept
 {
     NotifyChatMessageBroadcast notifyMessage{};
 
-    std::regex escapeHtml{"<[^>]+>\\s+(?=<)|<[^>]+>"};
     notifyMessage.MessageType = acType;
-    notifyMessage.PlayerName = std::regex_replace(aSendingPlayer->GetUsername(), escapeHtml, "");
-    notifyMessage.ChatMessage = std::regex_replace(acContent, escapeHtml, "");
+    notifyMessage.PlayerName = aSendingPlayer->GetChatName();
+    SanitizeChatText(acContent, notifyMessage.ChatMessage);
 
     auto character = aSendingPlayer->GetCharacter();
 
@@ -67,6 +64,9 @@ void OverlayService::HandleChatMessage(const PacketEvent<SendChatMessageRequest>
         return;
 
     sendPlayerMessage(acMessage.Packet.MessageType, acMessage.Packet.ChatMessage, acMessage.pPlayer);
+
+    m_world.GetScriptService().HandleChatMessageSent(acMessage.pPlayer->GetId(), acMessage.pPlayer->GetUsername(),
+                                                     acMessage.Packet.ChatMessage);
 }
 
 void OverlayService::OnPlayerDialogue(const PacketEvent<PlayerDialogueRequest>& acMessage) const noexcept
@@ -21,7 +21,7 @@ public:
 
 protected:
     /**
-     * @brief Applies regex on chat message and relays it to other clients.
+     * @brief Strips markup from the chat message and relays it to other clients.
      */
     void HandleChatMessage(const PacketEvent<SendChatMessageRequest>& acMessage) const noexcept;
     void HandlePlayerJoin(const PlayerEnterWorldEvent& acEvent) const noexcept;
@@ -5,6 +5,7 @@
 #include <Events/PlayerJoinEvent.h>
 #include <Events/PlayerLeaveEvent.h>
 #include <Events/UpdateEvent.h>
+#include <Game/TickProfiler.h>
 
 #include <Messages/NotifyPlayerList.h>
 #include <Messages/NotifyPartyInfo.h>
@@ -72,6 +73,8 @@ PartyService::Party* PartyService::GetPlayerParty(Player* const apPlayer) noexce
 
 void PartyService::OnUpdate(const UpdateEvent& acEvent) noexcept
 {
+    TICK_PROFILE_SCOPE("PartyService::OnUpdate");
+
     const auto cCurrentTick = GameServer::Get()->GetTick();
     if (m_nextInvitationExpire > cCurrentTick)
         return;
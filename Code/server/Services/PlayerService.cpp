@@ -9,7 +9,6 @@
 #include <Messages/ShiftGridCellRequest.h>
 #include <Messages/EnterExteriorCellRequest.h>
 #include <Messages/EnterInteriorCellRequest.h>
-#include <Messages/CharacterSpawnRequest.h>
 #include <Messages/PlayerRespawnRequest.h>
 #include <Messages/NotifyInventoryChanges.h>
 #include <Messages/NotifyPlayerRespawn.h>
@@ -58,6 +57,9 @@ void PlayerService::HandleGridCellShift(const PacketEvent<ShiftGridCellRequest>&
 
     m_world.GetDispatcher().trigger(PlayerLeaveCellEvent(oldCell));
 
+    // Spawns are streamed in batches by CharacterService
+    auto& pendingSpawns = pPlayer->GetPendingSpawns();
+
     auto characterView = m_world.view<CellIdComponent, CharacterComponent, OwnerComponent>();
     for (auto character : characterView)
     {
@@ -74,10 +76,8 @@ void PlayerService::HandleGridCellShift(const PacketEvent<ShiftGridCellRequest>&
             continue;
         }
 
-        CharacterSpawnRequest spawnMessage;
-        CharacterService::Serialize(m_world, character, &spawnMessage);
-
-        pPlayer->Send(spawnMessage);
+        if (std::find(std::begin(pendingSpawns), std::end(pendingSpawns), character) == std::end(pendingSpawns))
+            pendingSpawns.push_back(character);
     }
 }
 
@@ -126,22 +126,22 @@ void PlayerService::HandleInteriorCellEnter(const PacketEvent<EnterInteriorCellR
         }
     }
 
-    auto characterView = m_world.view<CellIdComponent, CharacterComponent, OwnerComponent>();
-    for (auto character : characterView)
-    {
-        const auto& ownedComponent = characterView.get<OwnerComponent>(character);
+    // Characters of the previous cell are gone on the client, spawns are streamed in batches by CharacterService
+    auto& pendingSpawns = pPlayer->GetPendingSpawns();
+    pendingSpawns.clear();
 
-        if (ownedComponent.GetOwner() == pPlayer)
-            continue;
+    auto characterView = m_world.view<CellIdComponent, CharacterComponent, OwnerComponent>();
+    m_world.GetMap().ForEachEntityInRange(pPlayer->GetCellComponent(), [&](entt::entity aCharacter) {
+        if (!characterView.contains(aCharacter))
+            return;
 
-        if (message.CellId != characterView.get<CellIdComponent>(character).Cell)
-            continue;
+        const auto& ownedComponent = characterView.get<OwnerComponent>(aCharacter);
 
-        CharacterSpawnRequest spawnMessage;
-        CharacterService::Serialize(m_world, character, &spawnMessage);
+        if (ownedComponent.GetOwner() == pPlayer)
+            return;
 
-        pPlayer->Send(spawnMessage);
-    }
+        pendingSpawns.push_back(aCharacter);
+    });
 
     SendPlayerCellChanged(pPlayer);
 }
@@ -173,6 +173,7 @@ void PlayerService::OnPlayerRespawnRequest(const PacketEvent<PlayerRespawnReques
             entry.Count = -goldToRemove;
 
             inventoryComponent.Content.AddOrRemoveEntry(entry);
+            inventoryComponent.IsDirtySpawnCache = true;
 
             NotifyInventoryChanges notifyInventoryChanges{};
             notifyInventoryChanges.ServerId = World::ToInteger(*character);
@@ -8,6 +8,7 @@
 #include <Events/UpdateEvent.h>
 
 #include <Components.h>
+#include <Game/TickProfiler.h>
 #include <GameServer.h>
 #include <TiltedCore/Filesystem.hpp>
 
@@ -18,8 +19,18 @@ namespace Script
 void CreateScriptBindings(sol::state& aState);
 }
 
+Console::Setting bAsyncScriptEvents{"Scripting:bAsyncEvents",
+                                    "Run onUpdate, onPlayerQuit and onChatMessageSent on a separate script thread", false};
+
 namespace
 {
+// Indexed by ScriptEvent
+constexpr std::string_view kScriptEventNames[] = {
+    "onCharacterMove", "onCharacterSpawn", "onCharacterDestroy", "onPlayerJoin",
+    "onPlayerQuit",    "onChatMessage",    "onUpdate",           "onChatMessageSent",
+};
+static_assert(std::size(kScriptEventNames) == static_cast<size_t>(ScriptEvent::kCount));
+
 int ScriptExceptionHandler(lua_State* L, sol::optional<const std::exception&> maybe_exception,
                          sol::string_view description)
 {
@@ -62,6 +73,9 @@ ScriptService::ScriptService(World& aWorld, entt::dispatcher& aDispatcher)
 
 ScriptService::~ScriptService()
 {
+    // Queued handlers still need the lua state
+    m_worker.Stop();
+
     auto &lockedState = m_lua.Lock().Get();
     for (auto& m : m_sandboxes)
     {
@@ -99,6 +113,12 @@ void ScriptService::Initialize(Resources::ResourceCollection& aCollection) noexc
         }
         LoadScript(entryPointPath);
     });
+
+    if (bAsyncScriptEvents)
+    {
+        m_worker.Start();
+        spdlog::info("Script events that cannot be canceled run on the script worker");
+    }
 }
 
 bool ScriptService::LoadScript(const std::filesystem::path& aPath)
@@ -108,6 +128,10 @@ bool ScriptService::LoadScript(const std::filesystem::path& aPath)
         auto lua = m_lua.Lock();
         auto& luaVm = lua.Get();
 
+        // Handlers added while the script loads are accounted to it
+        m_currentScriptId = static_cast<uint32_t>(m_scriptStats.size());
+        m_scriptStats.emplace_back(MakeUnique<ScriptStats>())->Name = aPath.parent_path().filename().string().c_str();
+
         auto &env = m_sandboxes.emplace_back(luaVm, sol::create, luaVm.globals());
         
         const sol::protected_function_result result = luaVm.safe_script_file(aPath.string(), env);
@@ -143,31 +167,34 @@ void ScriptService::BindInbuiltFunctions()
 
 std::tuple<bool, String> ScriptService::HandleCharacterMove(const entt::entity aNpc) noexcept
 {
-    return CallCancelableEvent("onCharacterMove", aNpc);
+    return CallCancelableEvent(ScriptEvent::kOnCharacterMove, aNpc);
 }
 
 std::tuple<bool, String> ScriptService::HandleCharacterSpawn(const entt::entity aNpc) noexcept
 {
-    return CallCancelableEvent("onCharacterSpawn", aNpc);
+    return CallCancelableEvent(ScriptEvent::kOnCharacterSpawn, aNpc);
 }
 
 std::tuple<bool, String> ScriptService::HandleCharacterDestoy(const entt::entity aNpc) noexcept
 {
-    return CallCancelableEvent("onCharacterDestroy", aNpc);
+    return CallCancelableEvent(ScriptEvent::kOnCharacterDestroy, aNpc);
 }
 
 std::tuple<bool, String> ScriptService::HandlePlayerJoin(const ConnectionId_t aPlayer) noexcept
 {
-    return CallCancelableEvent("onPlayerJoin", aPlayer);
+    return CallCancelableEvent(ScriptEvent::kOnPlayerJoin, aPlayer);
 }
 
 std::tuple<bool, String> ScriptService::HandleChatMessage(const entt::entity aSender, const String& aMessage) noexcept
 {
-    return CallCancelableEvent("onChatMessage", aSender, aMessage);
+    return CallCancelableEvent(ScriptEvent::kOnChatMessage, aSender, aMessage);
 }
 
 void ScriptService::HandlePlayerQuit(ConnectionId_t aConnectionId, Server::EDisconnectReason aReason) noexcept
 {
+    if (!HasHandlers(ScriptEvent::kOnPlayerQuit))
+        return;
+
     std::string reason;
 
     switch (aReason)
@@ -193,7 +220,46 @@ void ScriptService::HandlePlayerQuit(ConnectionId_t aConnectionId, Server::EDisc
         break;
     }
 
-    CallEvent("onPlayerQuit", aConnectionId, reason);
+    if (!CallEvent(ScriptEvent::kOnPlayerQuit, aConnectionId, std::move(reason)))
+        spdlog::warn("onPlayerQuit dropped for connection {:x}, the script worker is too far behind", aConnectionId);
+}
+
+void ScriptService::HandleChatMessageSent(uint32_t aPlayerId, const String& acUsername, const String& acMessage) noexcept
+{
+    if (!HasHandlers(ScriptEvent::kOnChatMessageSent))
+        return;
+
+    if (!CallEvent(ScriptEvent::kOnChatMessageSent, aPlayerId, std::string(acUsername), std::string(acMessage)))
+        spdlog::warn("onChatMessageSent dropped, the script worker is too far behind");
+}
+
+void ScriptService::RunOnGameThread(ScriptWorker::Job aCall) noexcept
+{
+    if (!ScriptWorker::IsWorkerThread())
+    {
+        aCall();
+        return;
+    }
+
+    if (!m_worker.PostToGame(std::move(aCall)))
+        spdlog::warn("Script call dropped, the game thread is too far behind");
+}
+
+void ScriptService::RecordCall(uint32_t aScriptId, std::chrono::steady_clock::duration aDuration) noexcept
+{
+    if (aScriptId >= m_scriptStats.size())
+        return;
+
+    auto& stats = *m_scriptStats[aScriptId];
+    const uint64_t cMicroseconds = std::chrono::duration_cast<std::chrono::microseconds>(aDuration).count();
+
+    stats.Calls.fetch_add(1, std::memory_order_relaxed);
+    stats.TotalMicroseconds.fetch_add(cMicroseconds, std::memory_order_relaxed);
+
+    auto max = stats.MaxMicroseconds.load(std::memory_order_relaxed);
+    while (cMicroseconds > max && !stats.MaxMicroseconds.compare_exchange_weak(max, cMicroseconds, std::memory_order_relaxed))
+    {
+    }
 }
 
 #if 0
@@ -208,12 +274,46 @@ void ScriptService::RegisterExtensions(ScriptContext& aContext)
 
 void ScriptService::OnUpdate(const UpdateEvent& acEvent) noexcept
 {
-    if (m_sandboxes.size() == 0)
+    TICK_PROFILE_SCOPE("ScriptService::OnUpdate");
+
+    m_worker.Pump();
+
+    if (!HasHandlers(ScriptEvent::kOnUpdate))
         return;
 
+    const auto cDelta = m_droppedUpdateDelta + acEvent.Delta;
+
+    if (m_worker.IsRunning())
+    {
+        // At most one onUpdate is queued, a busy worker skips ticks and sees the elapsed time in its next call
+        if (m_updatePending.load(std::memory_order_acquire))
+        {
+            m_droppedUpdateDelta = cDelta;
+            return;
+        }
+
+        m_updatePending.store(true, std::memory_order_release);
+
+        const bool cPosted = m_worker.Post([this, cDelta]() {
+            {
+                auto lua = m_lua.Lock();
+                InvokeHandlers(ScriptEvent::kOnUpdate, false, cDelta);
+            }
+
+            m_updatePending.store(false, std::memory_order_release);
+        });
+
+        if (!cPosted)
+            m_updatePending.store(false, std::memory_order_release);
+
+        m_droppedUpdateDelta = cPosted ? 0.f : cDelta;
+        return;
+    }
+
     try
     {
-        CallEvent("onUpdate", acEvent.Delta);
+        CallEvent(ScriptEvent::kOnUpdate, cDelta);
+        m_droppedUpdateDelta = 0.f;
     }
     catch (sol::error& exception)
     {
@@ -230,7 +330,17 @@ void ScriptService::OnPlayerEnterWorld(const PlayerEnterWorldEvent& acEvent) noe
 
 void ScriptService::AddEventHandler(const std::string acName, const sol::function acFunction) noexcept
 {
-    m_callbacks[String(acName)].push_back(acFunction);
+    const auto itor = std::find(std::begin(kScriptEventNames), std::end(kScriptEventNames), acName);
+    if (itor == std::end(kScriptEventNames))
+    {
+        spdlog::warn("addEventHandler: unknown event '{}', the handler will never be called", acName);
+        return;
+    }
+
+    const auto cEvent = static_cast<size_t>(std::distance(std::begin(kScriptEventNames), itor));
+
+    m_handlers[cEvent].push_back({sol::protected_function(acFunction), m_currentScriptId});
+    m_hasHandlers[cEvent].store(true, std::memory_order_release);
 }
 
 void ScriptService::CancelEvent(const std::string aReason) noexcept
@@ -2,6 +2,7 @@
 
 #include <Events/PacketEvent.h>
 #include <Events/UpdateEvent.h>
+#include <Scripting/ScriptWorker.h>
 #include <TiltedCore/Lockable.hpp>
 
 struct World;
@@ -13,6 +14,38 @@ namespace Resources
 struct ResourceCollection;
 }
 
+/**
+ * @brief Events scripts can subscribe to with addEventHandler.
+ *
+ * Handlers are resolved to their event when they are added, raising an event is an array lookup.
+ * Events that cannot be canceled may run on the script worker, see ScriptService::IsAsyncEvent.
+ */
+enum class ScriptEvent : uint8_t
+{
+    kOnCharacterMove,
+    kOnCharacterSpawn,
+    kOnCharacterDestroy,
+    kOnPlayerJoin,
+    kOnPlayerQuit,
+    kOnChatMessage,
+    kOnUpdate,
+    kOnChatMessageSent,
+    kCount
+};
+
+/**
+ * @brief Time spent in the event handlers of a script.
+ *
+ * Updated by whichever thread runs the handlers, read by the console.
+ */
+struct ScriptStats
+{
+    String Name;
+    std::atomic<uint64_t> Calls{0};
+    std::atomic<uint64_t> TotalMicroseconds{0};
+    std::atomic<uint64_t> MaxMicroseconds{0};
+};
+
 struct ScriptService
 {
     ScriptService(World& aWorld, entt::dispatcher& aDispatcher);
@@ -31,8 +64,36 @@ struct ScriptService
 
     std::tuple<bool, String> HandleChatMessage(const entt::entity aSender, const String& aMessage) noexcept;
 
+    // Raised once a chat message went through, meant for logging
+    void HandleChatMessageSent(uint32_t aPlayerId, const String& acUsername, const String& acMessage) noexcept;
+
     void HandlePlayerQuit(ConnectionId_t aConnectionId, Server::EDisconnectReason aReason) noexcept;
 
+    [[nodiscard]] bool HasHandlers(ScriptEvent aEvent) const noexcept
+    {
+        return m_hasHandlers[static_cast<size_t>(aEvent)].load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Runs the call now on the game thread, from the script worker it is queued to the next tick.
+     *
+     * Bindings that change the world go through this so they can be used from async handlers.
+     */
+    void RunOnGameThread(ScriptWorker::Job aCall) noexcept;
+
+    [[nodiscard]] const Vector<UniquePtr<ScriptStats>>& GetScriptStats() const noexcept { return m_scriptStats; }
+
+    /**
+     * @brief Events that are only observed, with Scripting:bAsyncEvents they run on the script worker.
+     *
+     * Their handlers get a copy of the event data and the world is not available to them.
+     */
+    [[nodiscard]] static constexpr bool IsAsyncEvent(ScriptEvent aEvent) noexcept
+    {
+        return aEvent == ScriptEvent::kOnUpdate || aEvent == ScriptEvent::kOnPlayerQuit ||
+               aEvent == ScriptEvent::kOnChatMessageSent;
+    }
+
   protected:
     // void RegisterExtensions(ScriptContext& aContext) override;
 
@@ -45,19 +106,36 @@ struct ScriptService
     void CancelEvent(std::string aReason) noexcept;
 
     template <typename... Args>
-    std::tuple<bool, String> CallCancelableEvent(const String& acName, Args&&... args) noexcept;
+    std::tuple<bool, String> CallCancelableEvent(ScriptEvent aEvent, Args&&... args) noexcept;
 
-    template <typename... Args> void CallEvent(const String& acName, Args&&... args) noexcept;
+    // Returns false if the event was dropped because the script worker is too far behind
+    template <typename... Args> bool CallEvent(ScriptEvent aEvent, Args&&... args) noexcept;
+
+    // Must be called with the lua state locked, returns true if a handler canceled the event
+    template <typename... Args> bool InvokeHandlers(ScriptEvent aEvent, bool aCancelable, const Args&... args) noexcept;
+    void RecordCall(uint32_t aScriptId, std::chrono::steady_clock::duration aDuration) noexcept;
 
   private:
     void BindInbuiltFunctions();
 
   private:
-    using TCallbacks = Vector<sol::function>;
+    struct Handler
+    {
+        sol::protected_function Function;
+        uint32_t ScriptId;
+    };
+
+    using THandlers = Vector<Handler>;
 
     World& m_world;
     bool m_eventCanceled{};
     String m_cancelReason;
+    // Script that handlers added right now belong to
+    uint32_t m_currentScriptId{};
+    // Time of the onUpdate events the worker could not take, added to the next one
+    float m_droppedUpdateDelta{};
+    // Set while an onUpdate call waits for or runs on the worker
+    std::atomic<bool> m_updatePending{false};
 
     entt::scoped_connection m_updateConnection;
     entt::scoped_connection m_rpcCallsRequest;
@@ -66,9 +144,12 @@ struct ScriptService
     // NOTE(Vince): keep in mind that cxx specifies construction and deconstruction order,
     // so do not touch this order of member variables
     TiltedPhoques::Lockable<sol::state, std::recursive_mutex> m_lua;
-    Map<String, TCallbacks> m_callbacks;
+    std::array<THandlers, static_cast<size_t>(ScriptEvent::kCount)> m_handlers;
+    std::array<std::atomic<bool>, static_cast<size_t>(ScriptEvent::kCount)> m_hasHandlers{};
+    Vector<UniquePtr<ScriptStats>> m_scriptStats;
     TiltedPhoques::Vector<sol::environment> m_sandboxes;
     sol::table m_globals{};
+    ScriptWorker m_worker;
 };
 
 #include "ScriptService.inl"
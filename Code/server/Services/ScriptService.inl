@@ -1,42 +1,66 @@
 #include <sol/sol.hpp>
 
 template <typename... Args>
-std::tuple<bool, String> ScriptService::CallCancelableEvent(const String& acName, Args&&... args) noexcept
+std::tuple<bool, String> ScriptService::CallCancelableEvent(ScriptEvent aEvent, Args&&... args) noexcept
 {
-    m_eventCanceled = false;
+    if (!HasHandlers(aEvent))
+        return {false, {}};
 
-    auto& callbacks = m_callbacks[acName];
+    // Waits for the script worker if it is running a handler
+    auto lua = m_lua.Lock();
 
-    for (auto& callback : callbacks)
-    {
-        sol::protected_function pf{callback};
-        auto result = pf(std::forward<Args>(args)...);
+    if (InvokeHandlers(aEvent, true, args...))
+        return std::make_tuple(true, m_cancelReason);
 
-        if (!result.valid())
-        {
-            sol::error err = result;
-            spdlog::error(err.what());
-        }
+    return {false, {}};
+}
+
+template <typename... Args> bool ScriptService::CallEvent(ScriptEvent aEvent, Args&&... args) noexcept
+{
+    if (!HasHandlers(aEvent))
+        return true;
 
-        if (m_eventCanceled == true)
-            return std::make_tuple(true, m_cancelReason);
+    if (IsAsyncEvent(aEvent) && m_worker.IsRunning())
+    {
+        // Arguments are copied, the handlers run after the caller returned
+        return m_worker.Post([this, aEvent, ... cArgs = std::decay_t<Args>(std::forward<Args>(args))]() {
+            auto lua = m_lua.Lock();
+            InvokeHandlers(aEvent, false, cArgs...);
+        });
     }
 
-    return std::make_tuple(false, "");
+    auto lua = m_lua.Lock();
+    InvokeHandlers(aEvent, false, args...);
+
+    return true;
 }
 
-template <typename... Args> void ScriptService::CallEvent(const String& acName, Args&&... args) noexcept
+template <typename... Args>
+bool ScriptService::InvokeHandlers(ScriptEvent aEvent, bool aCancelable, const Args&... args) noexcept
 {
-    auto& callbacks = m_callbacks[acName];
+    const auto& handlers = m_handlers[static_cast<size_t>(aEvent)];
+
+    m_eventCanceled = false;
 
-    for (auto& callback : callbacks)
+    // Indexed, a handler may add handlers to the same event
+    for (size_t i = 0; i < handlers.size(); ++i)
     {
-        sol::protected_function pf{callback};
-        auto result = pf(std::forward<Args>(args)...);
+        const auto cScriptId = handlers[i].ScriptId;
+        m_currentScriptId = cScriptId;
+
+        const auto cStart = std::chrono::steady_clock::now();
+        auto result = handlers[i].Function(args...);
+        RecordCall(cScriptId, std::chrono::steady_clock::now() - cStart);
+
         if (!result.valid())
         {
             sol::error err = result;
             spdlog::error(err.what());
         }
+
+        if (aCancelable && m_eventCanceled == true)
+            return true;
     }
+
+    return false;
 }
@@ -1,6 +1,7 @@
 #include <Events/PlayerJoinEvent.h>
 #include <Events/PlayerLeaveEvent.h>
 #include <Events/UpdateEvent.h>
+#include <Game/TickProfiler.h>
 #include <GameServer.h>
 #include <Services/ServerListService.h>
 
@@ -34,6 +35,8 @@ ServerListService::ServerListService(World& aWorld, entt::dispatcher& aDispatche
 
 void ServerListService::OnUpdate(const UpdateEvent& acEvent) noexcept
 {
+    TICK_PROFILE_SCOPE("ServerListService::OnUpdate");
+
     if (m_nextAnnounce < std::chrono::steady_clock::now())
     {
         Announce();
@@ -2,37 +2,50 @@
 
 #include <GameServer.h>
 #include <Services/StringCacheService.h>
-#include <Events/UpdateEvent.h>
 #include <Game/Player.h>
 
 StringCacheService::StringCacheService(World& aWorld, entt::dispatcher& aDispatcher)
     : m_world(aWorld)
-    , m_updateConnection(aDispatcher.sink<UpdateEvent>().connect<&StringCacheService::HandleUpdate>(this))
 {
+    GameServer::Get()->GetScheduler().AddJob("StringCacheService::ProcessDirty", 2000ms, [this]() { ProcessDirty(); });
 }
 
-void StringCacheService::HandleUpdate(const UpdateEvent&) const noexcept
+void StringCacheService::ProcessDirty() const noexcept
 {
-    static std::chrono::steady_clock::time_point lastSendTimePoint;
-    constexpr auto cDelayBetweenSnapshots = 2000ms;
-
-    const auto now = std::chrono::steady_clock::now();
-    if (now - lastSendTimePoint < cDelayBetweenSnapshots)
-        return;
-
-    lastSendTimePoint = now;
-
     auto& stringCache = StringCache::Get();
+    stringCache.ProcessDirty();
 
-    if (!stringCache.ProcessDirty())
-        return;
+    const auto cSize = static_cast<uint32_t>(stringCache.Size());
+    auto* pServer = GameServer::Get();
 
-    for (const auto pPlayer : m_world.GetPlayerManager())
+    // Players usually all trail the cache by the same ids, each distinct starting point is only
+    // built and encoded once
+    while (true)
     {
-        auto startId = pPlayer->GetStringCacheId();
-        auto update = stringCache.Serialize(startId);
-        pPlayer->SetStringCacheId(startId);
-
-        pPlayer->Send(update);
+        const Player* pBehind = nullptr;
+        for (const auto pPlayer : m_world.GetPlayerManager())
+        {
+            if (pPlayer->GetStringCacheId() < cSize)
+            {
+                pBehind = pPlayer;
+                break;
+            }
+        }
+
+        if (!pBehind)
+            break;
+
+        const auto cStartId = pBehind->GetStringCacheId();
+
+        auto endId = cStartId;
+        const auto update = stringCache.Serialize(endId);
+
+        pServer->Multicast(update, [cStartId](const Player* apPlayer) { return apPlayer->GetStringCacheId() == cStartId; });
+
+        for (auto pPlayer : m_world.GetPlayerManager())
+        {
+            if (pPlayer->GetStringCacheId() == cStartId)
+                pPlayer->SetStringCacheId(endId);
+        }
     }
 }
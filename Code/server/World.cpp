@@ -16,11 +16,20 @@
 #include <Services/WeatherService.h>
 #include <Services/ScriptService.h>
 #include <Services/MapService.h>
+#include <Services/NavMeshService.h>
 
 #include <es_loader/ESLoader.h>
 
 World::World()
 {
+    // Keep the interest grid in sync with every entity that has a location
+    on_construct<CellIdComponent>().connect<&Game::Map::OnCellConstruct>(m_map);
+    on_update<CellIdComponent>().connect<&Game::Map::OnCellUpdate>(m_map);
+    on_destroy<CellIdComponent>().connect<&Game::Map::OnCellDestroy>(m_map);
+
+    on_construct<FormIdComponent>().connect<&World::OnFormIdConstruct>(this);
+    on_destroy<FormIdComponent>().connect<&World::OnFormIdDestroy>(this);
+
     m_spAdminService = std::make_shared<AdminService>(*this, m_dispatcher);
     spdlog::default_logger()->sinks().push_back(std::static_pointer_cast<spdlog::sinks::sink>(m_spAdminService));
 
@@ -50,6 +59,9 @@ World::World()
         ctx().emplace<ModsComponent>().AddServerMod(it);
     }
 
+    // Built from the navmeshes of the records, empty when the server has no game data
+    ctx().emplace<NavMeshService>(*this);
+
     // late initialize the ScriptService to ensure all components are valid
     m_pScriptService = TiltedPhoques::MakeUnique<ScriptService>(*this, m_dispatcher);
 }
@@ -57,4 +69,21 @@ World::World()
 World::~World()
 {
     m_pScriptService.reset();
+
+    on_construct<CellIdComponent>().disconnect(m_map);
+    on_update<CellIdComponent>().disconnect(m_map);
+    on_destroy<CellIdComponent>().disconnect(m_map);
+
+    on_construct<FormIdComponent>().disconnect(this);
+    on_destroy<FormIdComponent>().disconnect(this);
+}
+
+void World::OnFormIdConstruct(entt::registry& aRegistry, entt::entity aEntity) noexcept
+{
+    m_formIdIndex.Add(aRegistry.get<FormIdComponent>(aEntity).Id, aEntity);
+}
+
+void World::OnFormIdDestroy(entt::registry& aRegistry, entt::entity aEntity) noexcept
+{
+    m_formIdIndex.Remove(aRegistry.get<FormIdComponent>(aEntity).Id, aEntity);
 }
@@ -8,8 +8,11 @@
 #include <Services/CalendarService.h>
 #include <Services/QuestService.h>
 #include <Services/ScriptService.h>
+#include <Services/NavMeshService.h>
 
 #include "Game/PlayerManager.h"
+#include "Game/Map.h"
+#include "Game/FormIdIndex.h"
 
 namespace ESLoader
 {
@@ -38,6 +41,9 @@ struct World : entt::registry
     PlayerManager& GetPlayerManager() noexcept { return m_playerManager; }
     const PlayerManager& GetPlayerManager() const noexcept { return m_playerManager; }
     ScriptService& GetScriptService() const noexcept { return *m_pScriptService; }
+    const NavMeshService& GetNavMeshService() const noexcept { return ctx().at<const NavMeshService>(); }
+    Game::Map& GetMap() noexcept { return m_map; }
+    const Game::Map& GetMap() const noexcept { return m_map; }
 
     // Null checked at start when MoPo is on!
     ESLoader::RecordCollection* GetRecordCollection() noexcept { return m_recordCollection.get(); }
@@ -46,11 +52,31 @@ struct World : entt::registry
 
     [[nodiscard]] static uint32_t ToInteger(entt::entity aEntity) { return to_integral(aEntity); }
 
+    /**
+     * @brief Looks up the entity tracking a game form through the FormIdComponent index.
+     *
+     * @tparam T Components the entity must also have to be returned.
+     */
+    template <class... T> [[nodiscard]] std::optional<entt::entity> FindByFormId(const GameId& acId) const noexcept
+    {
+        return m_formIdIndex.Find(acId, [this](entt::entity aEntity) {
+            if constexpr (sizeof...(T) > 0)
+                return all_of<T...>(aEntity);
+            else
+                return true;
+        });
+    }
+
 private:
+    void OnFormIdConstruct(entt::registry& aRegistry, entt::entity aEntity) noexcept;
+    void OnFormIdDestroy(entt::registry& aRegistry, entt::entity aEntity) noexcept;
+
     entt::dispatcher m_dispatcher;
 
     TiltedPhoques::SharedPtr<AdminService> m_spAdminService;
     TiltedPhoques::UniquePtr<ScriptService> m_pScriptService;
     PlayerManager m_playerManager;
+    Game::Map m_map;
+    FormIdIndex<entt::entity> m_formIdIndex;
     UniquePtr<ESLoader::RecordCollection> m_recordCollection;
 };
@@ -30,6 +30,7 @@ struct GameServerInstance final : IGameServerInstance
     bool IsListening() override;
     bool IsRunning() override;
     void Update() override;
+    void WaitForNextTick() override;
 
 private:
     GameServer m_gameServer;
@@ -61,6 +62,11 @@ void GameServerInstance::Update()
     m_gameServer.Update();
 }
 
+void GameServerInstance::WaitForNextTick()
+{
+    m_gameServer.WaitForNextTick();
+}
+
 // NOTE(Vince): For now we use this to compare the dll to the server.
 GS_EXPORT const char* GetBuildTag()
 {
@@ -135,6 +135,8 @@ void DediRunner::RunGSThread()
             if (m_console.Update())
                 PrintExecutorArrowHack();
         }
+
+        m_pServerInstance->WaitForNextTick();
     }
 }
 
@@ -4,18 +4,25 @@
 #include <TiltedCore/Serialization.hpp>
 
 #include <optional>
+#include <regex>
+#include <thread>
 
 #include <glm/vec2.hpp>
 #include <glm/vec3.hpp>
 
+#include "ChatSanitizer.h"
 #include "StringCache.h"
 #include "Messages/StringCacheUpdate.h"
 
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
 #include <catch2/catch.hpp>
 
 #include <Messages/ClientMessageFactory.h>
 #include <Messages/ServerMessageFactory.h>
+#include <Structs/IndexedInventory.h>
 #include <Structs/Vector2_NetQuantize.h>
+#include <Game/FormIdIndex.h>
+#include <Game/SnapshotBuilder.h>
 
 #include <TiltedCore/Math.hpp>
 #include <TiltedCore/Platform.hpp>
@@ -63,6 +70,70 @@ TEST_CASE("Encoding factory", "[encoding.factory]")
         auto pRequest = CastUnique<PartyAcceptInviteRequest>(std::move(pMessage));
         REQUIRE(pRequest->InviterId == request.InviterId);
     }
+
+    {
+        ClientMessageFactory factory;
+
+        ClientReferencesMoveRequest request;
+        request.Tick = 42;
+        request.Updates[1].UpdatedMovement.Direction = 1.f;
+        request.Updates[2].UpdatedMovement.Direction = 2.f;
+
+        const ClientReferencesMoveRequest* pFirst = nullptr;
+
+        {
+            Buffer::Writer writer(&buff);
+            request.Serialize(writer);
+
+            Buffer::Reader reader(&buff);
+
+            REQUIRE(factory.Dispatch(reader, [&](auto& aMessage) {
+                using T = std::remove_reference_t<decltype(aMessage)>;
+                if constexpr (std::is_same_v<T, ClientReferencesMoveRequest>)
+                {
+                    pFirst = &aMessage;
+                    REQUIRE(aMessage.Tick == request.Tick);
+                    REQUIRE(aMessage.Updates == request.Updates);
+                }
+            }));
+        }
+
+        REQUIRE(pFirst != nullptr);
+
+        // The instance is recycled and must not leak the previous message's updates
+        request.Tick = 43;
+        request.Updates.erase(1);
+
+        {
+            Buffer::Writer writer(&buff);
+            request.Serialize(writer);
+
+            Buffer::Reader reader(&buff);
+
+            bool visited = false;
+            REQUIRE(factory.Dispatch(reader, [&](auto& aMessage) {
+                using T = std::remove_reference_t<decltype(aMessage)>;
+                if constexpr (std::is_same_v<T, ClientReferencesMoveRequest>)
+                {
+                    visited = true;
+                    REQUIRE(&aMessage == pFirst);
+                    REQUIRE(aMessage.Tick == request.Tick);
+                    REQUIRE(aMessage.Updates == request.Updates);
+                }
+            }));
+
+            REQUIRE(visited);
+        }
+
+        {
+            Buffer::Writer writer(&buff);
+            writer.WriteBits(kClientOpcodeMax, sizeof(ClientOpcode) * 8);
+
+            Buffer::Reader reader(&buff);
+
+            REQUIRE_FALSE(factory.Dispatch(reader, [](auto&) {}));
+        }
+    }
 }
 
 TEST_CASE("Static structures", "[encoding.static]")
@@ -163,6 +234,72 @@ TEST_CASE("Static structures", "[encoding.static]")
             REQUIRE(sendObjects == recvObjects);
         }
     }
+
+    GIVEN("ActorValues")
+    {
+        ActorValues sendObjects, recvObjects;
+        sendObjects.ActorValuesList.Set(24, 150.f);
+        sendObjects.ActorValuesList.Set(26, -12.5f);
+        sendObjects.ActorValuesList.Set(163, 3.f);
+        sendObjects.ActorMaxValuesList.Set(0, 1.f);
+
+        {
+            Buffer buff(1000);
+            Buffer::Writer writer(&buff);
+
+            sendObjects.Serialize(writer);
+
+            Buffer::Reader reader(&buff);
+            recvObjects.Deserialize(reader);
+
+            REQUIRE(sendObjects == recvObjects);
+            REQUIRE(recvObjects.ActorValuesList.Size() == 3);
+            REQUIRE(recvObjects.ActorValuesList.Get(26) == -12.5f);
+            REQUIRE(recvObjects.ActorMaxValuesList == sendObjects.ActorMaxValuesList);
+            REQUIRE_FALSE(recvObjects.ActorValuesList.Contains(25));
+        }
+
+        {
+            ActorValueBlock changes;
+            changes.Set(26, 4.f);
+            changes.Set(30, 8.f);
+
+            auto& values = sendObjects.ActorValuesList;
+            values.Merge(changes);
+            values.Merge(changes);
+            REQUIRE(values.IsDirty());
+            REQUIRE(values.Size() == 4);
+
+            const auto cDirty = values.TakeDirty();
+            REQUIRE(cDirty == changes);
+            REQUIRE_FALSE(values.IsDirty());
+
+            uint32_t previousId = 0;
+            for (const auto [id, value] : values)
+            {
+                REQUIRE(id >= previousId);
+                REQUIRE(value == values.Get(id));
+                previousId = id;
+            }
+            REQUIRE(previousId == 163);
+        }
+
+        {
+            // A mask larger than any writer produces is rejected before its words are read
+            Buffer buff(1000);
+            Buffer::Writer writer(&buff);
+            Serialization::WriteVarInt(writer, 0xFFFFFFFFFFFFull);
+            Serialization::WriteVarInt(writer, 1);
+
+            ActorValueBlock malformed;
+            malformed.Set(3, 1.f);
+
+            Buffer::Reader reader(&buff);
+            malformed.Deserialize(reader);
+
+            REQUIRE(malformed.Empty());
+        }
+    }
 }
 
 TEST_CASE("Differential structures", "[encoding.differential]")
@@ -323,6 +460,71 @@ TEST_CASE("Differential structures", "[encoding.differential]")
             REQUIRE(vars.Integers == recvVars.Integers);
         }
     }
+
+    GIVEN("MovementDelta")
+    {
+        Movement sendMovement, recvMovement;
+        sendMovement.CellId = GameId(1, 0x3C);
+        sendMovement.WorldSpaceId = GameId(1, 0x3C);
+        sendMovement.Position = glm::vec3(-1230.f, 4850.f, -20.f);
+        sendMovement.Direction = 0.5f;
+        sendMovement.Variables.Booleans = 0x12345678ull;
+        sendMovement.Variables.Integers = {0, 12000, 7778};
+        sendMovement.Variables.Floats = {1.f, 7.f, -1.f};
+
+        Movement baseline = sendMovement;
+
+        {
+            Buffer buff(1000);
+            Buffer::Writer writer(&buff);
+
+            MovementDelta::MakeKeyframe(sendMovement).Serialize(writer);
+
+            MovementDelta recvDelta;
+            Buffer::Reader reader(&buff);
+            recvDelta.Deserialize(reader);
+            recvDelta.Apply(recvMovement);
+
+            REQUIRE(recvDelta.IsKeyframe());
+            REQUIRE(sendMovement == recvMovement);
+        }
+
+        sendMovement.Position = glm::vec3(-1228.f, 4851.f, -20.f);
+        sendMovement.Variables.Floats[1] = 42.f;
+
+        {
+            Buffer buff(1000);
+            Buffer::Writer writer(&buff);
+
+            const auto sendDelta = MovementDelta::Make(baseline, sendMovement);
+            sendDelta.Serialize(writer);
+
+            REQUIRE(sendDelta.Changes == (MovementDelta::kPosition | MovementDelta::kVariables));
+
+            MovementDelta recvDelta;
+            Buffer::Reader reader(&buff);
+            recvDelta.Deserialize(reader);
+            recvDelta.Apply(recvMovement);
+
+            REQUIRE(sendDelta == recvDelta);
+            REQUIRE(sendMovement == recvMovement);
+        }
+
+        {
+            Buffer buff(1000);
+            Buffer::Writer writer(&buff);
+
+            MovementDelta::Make(sendMovement, sendMovement).Serialize(writer);
+
+            MovementDelta recvDelta;
+            Buffer::Reader reader(&buff);
+            recvDelta.Deserialize(reader);
+            recvDelta.Apply(recvMovement);
+
+            REQUIRE(recvDelta.Changes == 0);
+            REQUIRE(sendMovement == recvMovement);
+        }
+    }
 }
 
 TEST_CASE("Packets", "[encoding.packets]")
@@ -474,6 +676,148 @@ TEST_CASE("Packets", "[encoding.packets]")
 
         REQUIRE(recvMessage.Updates[1].UpdatedMovement == sendMessage.Updates[1].UpdatedMovement);
     }
+
+    GIVEN("ServerReferencesMoveRequest")
+    {
+        ServerReferencesMoveRequest sendMessage, recvMessage;
+        sendMessage.Tick = 42;
+
+        Movement movement;
+        movement.Position = glm::vec3(100.f, -200.f, 300.f);
+        movement.Variables.Booleans = 0x12345678ull;
+        movement.Variables.Floats.push_back(145.f);
+        movement.Variables.Integers.push_back(7778);
+
+        sendMessage.Updates[1].UpdatedMovement = MovementDelta::MakeKeyframe(movement);
+
+        Movement nextMovement = movement;
+        nextMovement.Position.x += 3.f;
+        sendMessage.Updates[2].UpdatedMovement = MovementDelta::Make(movement, nextMovement);
+
+        ReferenceDelta encodedUpdate;
+        encodedUpdate.UpdatedMovement = MovementDelta::MakeKeyframe(nextMovement);
+        encodedUpdate.ActionEvents.resize(1);
+        encodedUpdate.ActionEvents[0].ActionId = 42;
+
+        Buffer encodedBuff(1000);
+        Buffer::Writer encodedWriter(&encodedBuff);
+        encodedUpdate.Serialize(encodedWriter);
+        sendMessage.EncodedUpdates.push_back({3, {encodedBuff.GetWriteData(), encodedWriter.Size()}});
+
+        Buffer buff(1000);
+        Buffer::Writer writer(&buff);
+        sendMessage.Serialize(writer);
+
+        Buffer::Reader reader(&buff);
+
+        uint64_t trash;
+        reader.ReadBits(trash, 8); // pop opcode
+
+        recvMessage.DeserializeRaw(reader);
+
+        REQUIRE(recvMessage.Updates[3] == encodedUpdate);
+        recvMessage.Updates.erase(3);
+
+        REQUIRE(sendMessage == recvMessage);
+    }
+    GIVEN("CharacterSpawnBatchRequest")
+    {
+        CharacterSpawnBatchRequest sendMessage, recvMessage;
+        sendMessage.Appearances.push_back("shared");
+
+        CharacterSpawnRequest encodedSpawn;
+        encodedSpawn.ServerId = 3;
+        encodedSpawn.BaseId = GameId(0, 0x1234);
+        encodedSpawn.IsDead = true;
+
+        encodedSpawn.ChangeFlags = 0x4;
+
+        Buffer stateBuff(1000), contentBuff(1000);
+        Buffer::Writer stateWriter(&stateBuff), contentWriter(&contentBuff);
+        encodedSpawn.SerializeState(stateWriter);
+        encodedSpawn.SerializeContent(contentWriter);
+
+        // Views come after the appearances in the table
+        sendMessage.AppearanceViews.push_back("viewed");
+        sendMessage.EncodedSpawns.push_back({0, {stateBuff.GetWriteData(), stateWriter.Size()}, {contentBuff.GetWriteData(), contentWriter.Size()}});
+        sendMessage.EncodedSpawns.push_back({1, {stateBuff.GetWriteData(), stateWriter.Size()}, {contentBuff.GetWriteData(), contentWriter.Size()}});
+
+        sendMessage.Spawns.resize(2);
+        sendMessage.Spawns[0].ServerId = 1;
+        sendMessage.Spawns[0].BaseId = GameId(0, 0x1234);
+        sendMessage.Spawns[0].AppearanceBuffer = "shared";
+        sendMessage.Spawns[1].ServerId = 2;
+        sendMessage.Spawns[1].AppearanceBuffer = "other";
+        sendMessage.Spawns[1].ChangeFlags = 0x8;
+
+        Buffer buff(1000);
+        Buffer::Writer writer(&buff);
+        sendMessage.Serialize(writer);
+
+        Buffer::Reader reader(&buff);
+
+        uint64_t trash;
+        reader.ReadBits(trash, 8); // pop opcode
+
+        recvMessage.DeserializeRaw(reader);
+
+        // The first spawn reuses the appearance already in the table
+        REQUIRE(recvMessage.Appearances.size() == 3);
+        REQUIRE(recvMessage.Spawns.size() == 4);
+
+        encodedSpawn.AppearanceBuffer = "viewed";
+        REQUIRE(recvMessage.Spawns[3] == encodedSpawn);
+        encodedSpawn.AppearanceBuffer = "shared";
+        REQUIRE(recvMessage.Spawns[2] == encodedSpawn);
+        recvMessage.Spawns.resize(2);
+
+        REQUIRE(sendMessage == recvMessage);
+    }
+
+    GIVEN("NotifyMessageBundle")
+    {
+        NotifyHealthChangeBroadcast health;
+        health.Id = 12;
+        health.DeltaHealth = 7.5f;
+
+        NotifyActorValueChanges values;
+        values.Id = 12;
+        values.Values.Set(26, 40.f);
+
+        Buffer healthBuff(1000), valuesBuff(1000);
+        Buffer::Writer healthWriter(&healthBuff), valuesWriter(&valuesBuff);
+        health.Serialize(healthWriter);
+        values.Serialize(valuesWriter);
+
+        NotifyMessageBundle sendMessage, recvMessage;
+        sendMessage.Payloads.push_back({healthBuff.GetWriteData(), healthWriter.Size()});
+        sendMessage.Payloads.push_back({valuesBuff.GetWriteData(), valuesWriter.Size()});
+
+        // Nested bundles are dropped
+        Buffer nestedBuff(1000);
+        Buffer::Writer nestedWriter(&nestedBuff);
+        NotifyMessageBundle nested;
+        nested.Payloads.push_back({healthBuff.GetWriteData(), healthWriter.Size()});
+        nested.Serialize(nestedWriter);
+        sendMessage.Payloads.push_back({nestedBuff.GetWriteData(), nestedWriter.Size()});
+
+        Buffer buff(1000);
+        Buffer::Writer writer(&buff);
+        sendMessage.Serialize(writer);
+
+        Buffer::Reader reader(&buff);
+
+        uint64_t trash;
+        reader.ReadBits(trash, 8); // pop opcode
+
+        recvMessage.DeserializeRaw(reader);
+
+        REQUIRE(recvMessage.Messages.size() == 2);
+        REQUIRE(recvMessage.Messages[0]->GetOpcode() == NotifyHealthChangeBroadcast::Opcode);
+        REQUIRE(static_cast<const NotifyHealthChangeBroadcast&>(*recvMessage.Messages[0]) == health);
+        REQUIRE(recvMessage.Messages[1]->GetOpcode() == NotifyActorValueChanges::Opcode);
+        REQUIRE(static_cast<const NotifyActorValueChanges&>(*recvMessage.Messages[1]) == values);
+    }
 }
 
 TEST_CASE("StringCache", "[encoding.string_cache]")
@@ -498,4 +842,419 @@ TEST_CASE("StringCache", "[encoding.string_cache]")
 
         REQUIRE(update == recvUpdate);
     }
+    SECTION("Cached strings")
+    {
+        auto& cache = StringCache::Get();
+        const auto cId = cache.Add("cached");
+
+        CachedString sendString, recvString;
+        sendString = String("cached");
+
+        Buffer buff(100);
+        {
+            Buffer::Writer writer(&buff);
+            sendString.Serialize(writer);
+        }
+
+        {
+            Buffer::Reader reader(&buff);
+            REQUIRE(Serialization::ReadBool(reader));
+            REQUIRE(Serialization::ReadVarInt(reader) == cId);
+        }
+
+        {
+            Buffer::Reader reader(&buff);
+            recvString.Deserialize(reader);
+
+            REQUIRE(recvString == sendString);
+        }
+
+        // Ids resolved before a clear must not be sent anymore
+        cache.Clear();
+
+        {
+            Buffer::Writer writer(&buff);
+            sendString.Serialize(writer);
+
+            Buffer::Reader reader(&buff);
+            REQUIRE_FALSE(Serialization::ReadBool(reader));
+            REQUIRE(Serialization::ReadString(reader) == "cached");
+        }
+
+        REQUIRE(cache.Add("cached") == 0);
+    }
+
+    SECTION("Concurrent interning")
+    {
+        auto& cache = StringCache::Get();
+        cache.Clear();
+
+        constexpr uint32_t kStringCount = 200;
+
+        Vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&cache]() {
+                for (uint32_t i = 0; i < kStringCount; ++i)
+                    TP_UNUSED(cache.Add(std::to_string(i).c_str()))
+            });
+        }
+
+        for (auto& thread : threads)
+            thread.join();
+
+        // Every string got exactly one id and each id maps back to its string
+        REQUIRE(cache.Size() == kStringCount);
+        for (uint32_t id = 0; id < kStringCount; ++id)
+            REQUIRE(cache[*cache.Find(id)] == id);
+
+        uint32_t startId = kStringCount / 2;
+        const auto update = cache.Serialize(startId);
+
+        REQUIRE(startId == kStringCount);
+        REQUIRE(update.Values.size() == kStringCount / 2);
+
+        cache.Clear();
+    }
+}
+
+namespace
+{
+// What the overlay service used to run on every chat message
+String RegexSanitize(const String& acInput)
+{
+    std::regex escapeHtml{"<[^>]+>\\s+(?=<)|<[^>]+>"};
+    return std::regex_replace(acInput, escapeHtml, "");
+}
+} // namespace
+
+TEST_CASE("Chat sanitizer", "[encoding.chat_sanitizer]")
+{
+    const String cInputs[] = {
+        "",
+        "hello there",
+        "<b>bold</b> text",
+        "<img src=x onerror=alert(1)>",
+        "<b> <i>nested</i> </b> end",
+        "a < b and c > d",
+        "<> is not a tag",
+        "unclosed <tag",
+        "<<b>>",
+        "<p>\t\n<p>  text  <p>",
+        "trailing <b>   ",
+    };
+
+    for (const auto& input : cInputs)
+    {
+        CAPTURE(input);
+        REQUIRE(SanitizeChatText(input) == RegexSanitize(input));
+    }
+}
+
+TEST_CASE("Chat sanitizer benchmark", "[.][benchmark]")
+{
+    const String cMessage = "<font color='#ff0000'>Hey</font> <b>everyone</b>, meet me at Whiterun's gate in 5 minutes <3";
+
+    BENCHMARK("std::regex")
+    {
+        return RegexSanitize(cMessage);
+    };
+
+    String output;
+    BENCHMARK("SanitizeChatText")
+    {
+        SanitizeChatText(cMessage, output);
+        return output.size();
+    };
+}
+
+namespace
+{
+Inventory::Entry MakeEntry(uint32_t aBaseId, uint32_t aVariant, int32_t aCount)
+{
+    Inventory::Entry entry;
+    entry.BaseId = GameId(0, aBaseId);
+    entry.Count = aCount;
+    entry.ExtraHealth = static_cast<float>(aVariant);
+
+    return entry;
+}
+
+Inventory MakeEquipment(uint32_t aSeed, uint32_t aBaseIds)
+{
+    Inventory equipment;
+    for (uint32_t i = 0; i < 8; ++i)
+    {
+        auto entry = MakeEntry((aSeed * 7 + i * 13) % aBaseIds, 0, 1);
+        entry.ExtraWorn = (i & 1) == 0;
+        entry.ExtraWornLeft = !entry.ExtraWorn;
+        equipment.Entries.push_back(entry);
+    }
+
+    return equipment;
+}
+} // namespace
+
+TEST_CASE("Indexed inventory", "[encoding.indexed_inventory]")
+{
+    constexpr uint32_t kBaseIds = 24;
+
+    Inventory plain;
+    IndexedInventory indexed;
+
+    uint32_t seed = 1;
+    const auto next = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return seed >> 8;
+    };
+
+    for (uint32_t i = 0; i < 4000; ++i)
+    {
+        const auto cRoll = next();
+
+        if (cRoll % 16 == 0)
+        {
+            const auto cEquipment = MakeEquipment(next(), kBaseIds);
+            plain.UpdateEquipment(cEquipment);
+            indexed.UpdateEquipment(cEquipment);
+        }
+        else
+        {
+            const int32_t cCount = static_cast<int32_t>(next() % 7) - 3;
+            const auto cEntry = MakeEntry(next() % kBaseIds, next() % 3, cCount == 0 ? 1 : cCount);
+            plain.AddOrRemoveEntry(cEntry);
+            indexed.AddOrRemoveEntry(cEntry);
+        }
+
+        const auto& cContent = indexed.GetInventory();
+        REQUIRE(cContent.Entries.size() == plain.Entries.size());
+        REQUIRE(cContent.CurrentMagicEquipment == plain.CurrentMagicEquipment);
+    }
+
+    // Entry order differs once something was removed, compare as sets
+    const auto& cContent = indexed.GetInventory();
+    for (const auto& entry : plain.Entries)
+    {
+        REQUIRE(std::count(std::begin(cContent.Entries), std::end(cContent.Entries), entry) == std::count(std::begin(plain.Entries), std::end(plain.Entries), entry));
+    }
+
+    GameId missing(0, kBaseIds + 1);
+    REQUIRE(indexed.GetEntryCountById(missing) == 0);
+
+    IndexedInventory copy;
+    copy = plain;
+    REQUIRE(copy.GetInventory() == plain);
+
+    const auto cEquipment = MakeEquipment(3, kBaseIds);
+    plain.UpdateEquipment(cEquipment);
+    copy.UpdateEquipment(cEquipment);
+    REQUIRE(copy.GetInventory() == plain);
+}
+
+TEST_CASE("Indexed inventory benchmark", "[.][benchmark]")
+{
+    // A well stocked container, a thousand distinct entries
+    constexpr uint32_t kBaseIds = 1000;
+
+    Inventory plain;
+    IndexedInventory indexed;
+    for (uint32_t i = 0; i < kBaseIds; ++i)
+        plain.Entries.push_back(MakeEntry(i, 0, 10));
+    indexed = plain;
+
+    uint32_t item = 0;
+    BENCHMARK("Inventory::AddOrRemoveEntry")
+    {
+        item = (item + 379) % kBaseIds;
+        plain.AddOrRemoveEntry(MakeEntry(item, 0, 1));
+        plain.AddOrRemoveEntry(MakeEntry(item, 0, -1));
+        return plain.Entries.size();
+    };
+
+    BENCHMARK("IndexedInventory::AddOrRemoveEntry")
+    {
+        item = (item + 379) % kBaseIds;
+        indexed.AddOrRemoveEntry(MakeEntry(item, 0, 1));
+        indexed.AddOrRemoveEntry(MakeEntry(item, 0, -1));
+        return indexed.GetInventory().Entries.size();
+    };
+
+    uint32_t round = 0;
+    BENCHMARK("Inventory::UpdateEquipment")
+    {
+        plain.UpdateEquipment(MakeEquipment(++round, kBaseIds));
+        return plain.Entries.size();
+    };
+
+    BENCHMARK("IndexedInventory::UpdateEquipment")
+    {
+        indexed.UpdateEquipment(MakeEquipment(++round, kBaseIds));
+        return indexed.GetInventory().Entries.size();
+    };
+}
+
+TEST_CASE("Form id index benchmark", "[.][benchmark]")
+{
+    // A populated world and a cell entry assigning every object of the cell
+    constexpr uint32_t kReferences = 16384;
+    constexpr uint32_t kCellObjects = 200;
+
+    struct FormIdEntity
+    {
+        GameId Id;
+        uint32_t Entity;
+    };
+
+    Vector<FormIdEntity> entities;
+    FormIdIndex<uint32_t> index;
+    for (uint32_t i = 0; i < kReferences; ++i)
+    {
+        const GameId cId(i % 4, 0x1000 + i * 7);
+        entities.push_back({cId, i});
+        index.Add(cId, i);
+    }
+
+    // Half of the objects are not tracked yet, as when a cell is entered for the first time
+    Vector<GameId> cellObjects;
+    for (uint32_t i = 0; i < kCellObjects; ++i)
+    {
+        const uint32_t cReference = (i * 7919) % kReferences;
+        cellObjects.push_back((i & 1) ? GameId(cReference % 4, 0x1000 + cReference * 7) : GameId(5, i));
+    }
+
+    BENCHMARK("Linear scan")
+    {
+        uint32_t found = 0;
+        for (const auto& cId : cellObjects)
+        {
+            const auto itor = std::find_if(std::begin(entities), std::end(entities), [&cId](const FormIdEntity& acEntity) { return acEntity.Id == cId; });
+            if (itor != std::end(entities))
+                ++found;
+        }
+        return found;
+    };
+
+    BENCHMARK("FormIdIndex::Find")
+    {
+        uint32_t found = 0;
+        for (const auto& cId : cellObjects)
+        {
+            if (index.Find(cId, [](uint32_t) { return true; }))
+                ++found;
+        }
+        return found;
+    };
+}
+
+TEST_CASE("Snapshot builder", "[encoding.snapshot_builder]")
+{
+    constexpr uint32_t cServerId = 42;
+
+    SnapshotBuilder builder;
+    Movement current;
+    current.Position = glm::vec3(100.f, -200.f, 300.f);
+    current.Variables.Floats = {1.f, 2.f};
+
+    const Vector<ActionEvent> cNoActionEvents;
+    const auto fill = [&](Movement& aMovement) -> const Vector<ActionEvent>& {
+        aMovement = current;
+        return cNoActionEvents;
+    };
+
+    const auto apply = [&](const SnapshotBuilder::Slice& acSlice, Movement& aMovement) {
+        const auto cData = builder.GetData(acSlice);
+
+        Buffer buff(cData.size());
+        std::copy(std::begin(cData), std::end(cData), buff.GetWriteData());
+
+        ReferenceDelta update;
+        Buffer::Reader reader(&buff);
+        update.Deserialize(reader);
+        update.UpdatedMovement.Apply(aMovement);
+    };
+
+    Movement existingObserver, newObserver;
+
+    builder.BeginTick();
+    const auto keyframe = builder.Get(cServerId, true, true, fill);
+    REQUIRE(keyframe);
+    apply(keyframe, existingObserver);
+    builder.EndTick();
+
+    REQUIRE(existingObserver == current);
+
+    SECTION("Moved reference")
+    {
+        current.Position = glm::vec3(104.f, -200.f, 300.f);
+
+        builder.BeginTick();
+        const auto delta = builder.Get(cServerId, false, true, fill);
+        const auto newKeyframe = builder.Get(cServerId, true, true, fill);
+        REQUIRE(delta);
+        REQUIRE(newKeyframe);
+        REQUIRE(builder.Get(cServerId, false, true, fill).Offset == delta.Offset);
+        apply(delta, existingObserver);
+        apply(newKeyframe, newObserver);
+        builder.EndTick();
+
+        REQUIRE(existingObserver == current);
+        REQUIRE(newObserver == current);
+    }
+
+    SECTION("Reference moved without a broadcast")
+    {
+        // A teleport that does not flag the movement as changed
+        current.Position = glm::vec3(9000.f, 4000.f, 300.f);
+
+        builder.BeginTick();
+        REQUIRE_FALSE(builder.Get(cServerId, false, false, fill));
+        const auto newKeyframe = builder.Get(cServerId, true, false, fill);
+        REQUIRE(newKeyframe);
+        apply(newKeyframe, newObserver);
+        builder.EndTick();
+
+        // Both observers must hold the same baseline for the next delta
+        REQUIRE(newObserver == existingObserver);
+
+        current.Position = glm::vec3(9004.f, 4000.f, 300.f);
+
+        builder.BeginTick();
+        const auto delta = builder.Get(cServerId, false, true, fill);
+        REQUIRE(delta);
+        apply(delta, existingObserver);
+        apply(delta, newObserver);
+        builder.EndTick();
+
+        REQUIRE(existingObserver == current);
+        REQUIRE(newObserver == current);
+    }
+
+    SECTION("Update too large to be sent")
+    {
+        Vector<ActionEvent> actionEvents(ServerReferencesMoveRequest::kMaxUpdateSize);
+        for (auto& actionEvent : actionEvents)
+            actionEvent.ActionId = 42;
+
+        const auto fillActions = [&](Movement& aMovement) -> const Vector<ActionEvent>& {
+            aMovement = current;
+            return actionEvents;
+        };
+
+        current.Position = glm::vec3(104.f, -200.f, 300.f);
+
+        builder.BeginTick();
+        REQUIRE_FALSE(builder.Get(cServerId, false, true, fillActions));
+        REQUIRE_FALSE(builder.Get(cServerId, true, true, fillActions));
+        builder.EndTick();
+
+        // Nobody holds the dropped movement, everyone gets a keyframe
+        builder.BeginTick();
+        const auto resync = builder.Get(cServerId, false, false, fill);
+        REQUIRE(resync);
+        REQUIRE(builder.Get(cServerId, true, false, fill).Offset == resync.Offset);
+        apply(resync, existingObserver);
+        builder.EndTick();
+
+        REQUIRE(existingObserver == current);
+    }
 }
@@ -4,13 +4,15 @@ target("TPTests")
     set_group("Tests")
     add_defines("TP_SKYRIM=1")
     add_includedirs(
-        ".", "../encoding")
+        ".", "../encoding", "../server")
     add_headerfiles("**.h")
-    add_files("*.cpp")
+    add_files("*.cpp", "../server/Game/SnapshotBuilder.cpp")
+    set_pcxxheader("../encoding/EncodingPch.h")
     add_deps("SkyrimEncoding")
     add_packages(
         "tiltedcore",
         "hopscotch-map",
         "catch2",
+        "spdlog",
         "mimalloc",
         "glm")
@@ -13,3 +13,4 @@ includes("server_runner")
 includes("server")
 includes("encoding")
 includes("tests")
+includes("load_test")